@@ -0,0 +1,131 @@
+#!/bin/bash
+
+# cache.sh
+# - sourced by display.sh, display_mc.sh and display_batch.sh
+# - keeps the analysis outputs in a local cache, keyed by run and dir number
+
+# Settings, can be overridden from the environment
+# - REMOTE_SOURCE: where the outputs are, one of:
+#   * host:/path, copied with scp
+#   * /local/path, a local directory standing in for the server, copied with cp
+#   * root://host//path or https://host/path, not copied: ROOT reads only the baskets it needs
+# - CACHE_DIR: local cache directory
+# - CACHE_MAX_MB: the least recently used files are deleted above this size
+
+REMOTE_SOURCE=${REMOTE_SOURCE:-"alice-serv14.physi.uni-heidelberg.de:/misc/alidata121/alice_u/borquez/analysis/output/signal+bkg"}
+export CACHE_DIR=${CACHE_DIR:-"${HOME}/.cache/event_display"}  # also read by ROOT, for the index of remote files
+CACHE_MAX_MB=${CACHE_MAX_MB:-5000}
+
+cache_prefix="$(basename ${0}) ::"
+
+# .meta files of the files used in this session, so that a batch never evicts the files it fetched earlier
+declare -A cache_in_use
+
+# print "<size> <mtime>" of a file in the remote source
+# - returns 1 if the file doesn't exist, 2 if the remote source can't be reached
+# - ssh may ask for a password, like scp does afterwards
+function remote_stat() {
+  local remote_path=${1}
+  if [[ ${REMOTE_SOURCE} == *:* ]]; then
+    ssh -n ${REMOTE_SOURCE%%:*} stat -c "'%s %Y'" ${remote_path} 2> /dev/null
+    case $? in
+      0) return 0 ;;
+      255) return 2 ;;  # ssh's own errors: host unknown, refused, login failed...
+      *) return 1 ;;
+    esac
+  else
+    [[ -d ${REMOTE_SOURCE} ]] || return 2
+    stat -c '%s %Y' ${remote_path} 2> /dev/null || return 1
+  fi
+}
+
+# copy a file from the remote source, keeping its modification time
+function remote_copy() {
+  local remote_path=${1}
+  local local_path=${2}
+  if [[ ${REMOTE_SOURCE} == *:* ]]; then
+    scp -p ${REMOTE_SOURCE%%:*}:${remote_path} ${local_path}
+  else
+    cp -p ${remote_path} ${local_path}
+  fi
+}
+
+# delete the least recently used files until the cache fits in CACHE_MAX_MB, except the ones used in this session
+function evict_cache() {
+  local max_kb=$((CACHE_MAX_MB * 1024))
+  local used_kb=$(du -sk ${CACHE_DIR} | cut -f1)
+
+  # the .meta files are touched on every use, so their mtime orders the files by last use
+  for meta_file in $(find ${CACHE_DIR} -name "*.meta" -printf "%T@ %p\n" | sort -n | cut -d" " -f2); do
+    [[ ${used_kb} -le ${max_kb} ]] && break
+    [[ -n ${cache_in_use[${meta_file}]} ]] && continue
+    echo "${cache_prefix} Evicting ${meta_file%.meta}.root from cache"
+    rm -f ${meta_file%.meta}.root ${meta_file%.meta}_index.root ${meta_file}
+    used_kb=$(du -sk ${CACHE_DIR} | cut -f1)
+  done
+
+  if [[ ${used_kb} -gt ${max_kb} ]]; then
+    echo "${cache_prefix} Cache holds $((used_kb / 1024)) MB, above CACHE_MAX_MB=${CACHE_MAX_MB}, the files in use can't be evicted"
+  fi
+}
+
+# fetch_file <file prefix> <run number> <dir number>
+# - sets file_name to the path ROOT should open
+function fetch_file() {
+  local file_prefix=${1}
+  local run_number=${2}
+  local dir_number=${3}
+
+  local remote_path="${REMOTE_SOURCE#*:}/${run_number}/${file_prefix}_${dir_number}.root"
+
+  # remote files that ROOT can read directly: only the needed baskets are transferred
+  if [[ ${REMOTE_SOURCE} == root://* || ${REMOTE_SOURCE} == http*://* ]]; then
+    file_name="${REMOTE_SOURCE}/${run_number}/${file_prefix}_${dir_number}.root"
+    echo "${cache_prefix} Reading ${file_name} remotely"
+    return 0
+  fi
+
+  mkdir -p ${CACHE_DIR}/${run_number}
+  file_name="${CACHE_DIR}/${run_number}/${file_prefix}_${dir_number}.root"
+  local meta_file="${file_name%.root}.meta"
+  cache_in_use[${meta_file}]=1
+
+  # a cached file is valid while its remote size and mtime don't change
+  local remote_meta
+  remote_meta=$(remote_stat ${remote_path})
+  local remote_status=$?
+  if [[ -f ${file_name} && -f ${meta_file} ]]; then
+    if [[ ${remote_status} -eq 2 ]]; then
+      echo "${cache_prefix} Remote not reachable, using cached ${file_name}"
+      touch ${meta_file}
+      return 0
+    fi
+    if [[ ${remote_status} -eq 1 ]]; then
+      echo "${cache_prefix} ${remote_path} no longer in ${REMOTE_SOURCE}, using cached ${file_name}"
+      touch ${meta_file}
+      return 0
+    fi
+    if [[ "${remote_meta}" == "$(cat ${meta_file})" ]]; then
+      echo "${cache_prefix} Using cached ${file_name}"
+      touch ${meta_file}
+      return 0
+    fi
+  fi
+
+  if [[ ${remote_status} -eq 2 ]]; then
+    echo "${cache_prefix} ERROR: couldn't reach ${REMOTE_SOURCE}"
+    return 1
+  fi
+  if [[ ${remote_status} -eq 1 ]]; then
+    echo "${cache_prefix} ERROR: ${remote_path} not found in ${REMOTE_SOURCE}"
+    return 1
+  fi
+
+  echo "${cache_prefix} Downloading ${remote_path}"
+  echo -n "${cache_prefix} "; remote_copy ${remote_path} ${file_name}.part || return 1
+  mv ${file_name}.part ${file_name}
+  echo "${remote_meta}" > ${meta_file}
+  echo "${cache_prefix}"
+
+  evict_cache
+}
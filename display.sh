@@ -28,6 +28,8 @@ idx_v0b=${input:13:3}
 event=$(expr "${event}" + 0)
 idx_v0a=$(expr "${idx_v0a}" + 0)
 idx_v0b=$(expr "${idx_v0b}" + 0)
+run_number_int=$(expr "${run_number}" + 0)
+dir_number_int=$(expr "${dir_number}" + 0)
 
 echo "display.sh :: Initiating display.sh"
 echo "display.sh :: ====================="
@@ -40,14 +42,11 @@ echo "display.sh ::"
 
 # Get files
 
-file_path="/misc/alidata121/alice_u/borquez/analysis/output/signal+bkg/${run_number}/SexaquarkResults_CustomV0s_${dir_number}.root"
-file_name="SexaquarkResults_CustomV0s_${run_number}_${dir_number}.root"
-echo "display.sh :: Downloading ${file_path} from alice-serv14"
-
-echo -n "display.sh :: "; scp alice-serv14.physi.uni-heidelberg.de:${file_path} ${file_name}
+source $(dirname ${0})/cache.sh
+fetch_file SexaquarkResults_CustomV0s ${run_number} ${dir_number} || exit 1
 echo "display.sh :: "
 
 # Execute command
 
 echo "display.sh :: Starting ROOT"
-echo -n "display.sh :: "; root 'SexaquarkDisplay.C("'${file_name}'", '${event}', '${idx_v0a}',  '${idx_v0b}')' &> ${input}.log
+echo -n "display.sh :: "; root 'SexaquarkDisplay.C("'${file_name}'", '${event}', '${idx_v0a}', '${idx_v0b}', '${run_number_int}', '${dir_number_int}')' &> ${input}.log
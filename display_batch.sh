@@ -0,0 +1,106 @@
+#!/bin/bash
+
+# display_batch.sh
+
+# Check environment
+
+if [[ -z ${ROOTSYS} ]]; then
+  echo "display_batch.sh :: ERROR: environment is not set, please set ROOT."
+  exit 1
+fi
+
+# Parse input
+
+candidates_list=${1}
+n_workers=${2:-4}
+output_format=${3:-png}
+view=${4:-sexaquark}
+output_dir=${5:-batch_output}
+
+if [[ ! -f ${candidates_list} ]]; then
+  echo "display_batch.sh :: ERROR: Usage: ./display_batch.sh <candidates list> [n_workers] [png|json] [sexaquark|event] [output dir]"
+  exit 1
+fi
+
+if [[ ${view} == "sexaquark" ]]; then
+  file_prefix="SexaquarkResults_CustomV0s"
+else
+  file_prefix="AnalysisResults_CustomV0s"
+fi
+
+echo "display_batch.sh :: Initiating display_batch.sh"
+echo "display_batch.sh :: ==========================="
+echo "display_batch.sh :: >> Candidates = ${candidates_list}"
+echo "display_batch.sh :: >> Workers    = ${n_workers}"
+echo "display_batch.sh :: >> Format     = ${output_format}"
+echo "display_batch.sh :: >> View       = ${view}"
+echo "display_batch.sh :: >> Output Dir = ${output_dir}"
+echo "display_batch.sh ::"
+
+mkdir -p ${output_dir}
+rm -f ${output_dir}/worker_*.txt ${output_dir}/worker_*.log
+
+# Get files
+# - each (run, dir) file is fetched once, through the local cache
+# - all the candidates of a file go to the same worker, so that each worker opens it once
+
+source $(dirname ${0})/cache.sh
+
+declare -A file_worker
+declare -A file_names
+n_files=0
+
+while read -r input; do
+  [[ -z ${input} ]] && continue
+
+  if [[ ${#input} -ne 16 ]]; then
+    echo "display_batch.sh :: Candidate ${input} discarded, it should contain exactly 16 digits."
+    continue
+  fi
+
+  run_number=${input:0:6}
+  dir_number="00${input:6:1}"
+
+  file_key="${run_number}_${dir_number}"
+
+  if [[ -z ${file_worker[${file_key}]} ]]; then
+    fetch_file ${file_prefix} ${run_number} ${dir_number} < /dev/null || continue
+    file_names[${file_key}]=${file_name}
+    file_worker[${file_key}]=$((n_files % n_workers))
+    n_files=$((n_files + 1))
+  fi
+
+  echo "${input} ${file_names[${file_key}]}" >> ${output_dir}/worker_${file_worker[${file_key}]}.txt
+done < ${candidates_list}
+echo "display_batch.sh ::"
+
+# Prepare geometry
+# - the workers share the geometry cache, extract it once here, so that they never write it while the others read it
+
+if [[ ! -f alice_tpc.root || alice.root -nt alice_tpc.root ]]; then
+  echo "display_batch.sh :: Extracting geometry into alice_tpc.root"
+  root -l -b -q ExtractGeometry.C || exit 1
+fi
+
+# Execute command
+# - TEve needs an X display, provide a virtual one when there is none
+# - workers are separate ROOT processes, each rendering its own list
+# - only the first worker writes geometry.json into the shared output dir
+
+x_wrapper=""
+if [[ -z ${DISPLAY} ]]; then
+  x_wrapper="xvfb-run -a"
+fi
+
+for worker_list in ${output_dir}/worker_*.txt; do
+  [[ -f ${worker_list} ]] || continue
+  sort -s -k2,2 -o ${worker_list} ${worker_list}
+  worker_log=${worker_list%.txt}.log
+  save_geometry="kFALSE"
+  [[ ${worker_list} == ${output_dir}/worker_0.txt ]] && save_geometry="kTRUE"
+  echo "display_batch.sh :: Starting ROOT on ${worker_list}, logging into ${worker_log}"
+  ${x_wrapper} root -l -q 'BatchDisplay.C("'${worker_list}'", "'${output_format}'", "'${output_dir}'", "'${view}'", '${save_geometry}')' &> ${worker_log} &
+done
+
+wait
+echo "display_batch.sh :: Done, output stored in ${output_dir}"
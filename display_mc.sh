@@ -41,14 +41,11 @@ echo "display_mc.sh ::"
 
 # Get files
 
-file_path="/misc/alidata121/alice_u/borquez/analysis/output/signal+bkg/${run_number}/AnalysisResults_CustomV0s_${dir_number}.root"
-file_name="AnalysisResults_CustomV0s_${run_number}_${dir_number}.root"
-echo "display_mc.sh :: Downloading ${file_path} from alice-serv14"
-
-echo -n "display_mc.sh :: "; scp alice-serv14.physi.uni-heidelberg.de:${file_path} ${file_name}
+source $(dirname ${0})/cache.sh
+fetch_file AnalysisResults_CustomV0s ${run_number} ${dir_number} || exit 1
 echo "display_mc.sh :: "
 
 # Execute command
 
 echo "display_mc.sh :: Starting ROOT"
-echo -n "display_mc.sh :: "; root 'EventDisplay.C("./'${file_name}'", '${event}', '${idx_v0a}', '${idx_v0b}')' &> ${input}.log
+echo -n "display_mc.sh :: "; root 'EventDisplay.C("'${file_name}'", '${event}', '${idx_v0a}', '${idx_v0b}')' &> ${input}.log
@@ -1,37 +1,68 @@
 #ifndef HEADERS_HXX
 #define HEADERS_HXX
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdlib>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <string>
 #include <vector>
 
+#include "RConfigure.h"
 #include "TROOT.h"
+#include "TApplication.h"
 #include "TSystem.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.h"
+#endif
+
+#include "TBufferJSON.h"
 #include "TChain.h"
+#include "TColor.h"
 #include "TCut.h"
+#include "TEnv.h"
 #include "TExec.h"
 #include "TFile.h"
+#include "TLeaf.h"
 #include "TLine.h"
+#include "TObjArray.h"
 #include "TObjString.h"
 #include "TPaletteAxis.h"
 #include "TPaveStats.h"
 #include "TPaveText.h"
+#include "TPolyLine3D.h"
+#include "TPolyMarker3D.h"
+#include "TRandom3.h"
+#include "TRegexp.h"
+#include "TStopwatch.h"
 #include "TString.h"
 #include "TStyle.h"
+#include "TTimer.h"
+#include "TTreeIndex.h"
 #include "TVector3.h"
 
 #include "TEveEventManager.h"
 #include "TEveGeoNode.h"
+#include "TEveGeoShape.h"
+#include "TEveGeoShapeExtract.h"
 #include "TEveLine.h"
 #include "TEveManager.h"
+#include "TEvePointSet.h"
 #include "TEveScene.h"
+#include "TEveStraightLineSet.h"
+#include "TEveTrans.h"
 #include "TEveViewer.h"
 
+#include "TGLCamera.h"
+#include "TGLViewer.h"
+
 #include "TGeoManager.h"
+#include "TGeoMatrix.h"
 #include "TGeoMaterial.h"
 #include "TGeoMedium.h"
 
@@ -0,0 +1,453 @@
+#ifndef HELIX_FUNCTIONS_HXX
+#define HELIX_FUNCTIONS_HXX
+
+#define TPC_MAX_RADIUS 460.  // [cm]
+#define TPC_MAX_Z 360.       // [cm]
+
+#define HELIX_TOLERANCE 0.1  // max. distance between the drawn segments and the true helix [cm]
+#define HELIX_MIN_STEP 0.5   // [cm]
+#define HELIX_MAX_STEP 50.   // [cm]
+
+//_____________________________________________________________________________
+struct HelixBatch_tt {
+    //
+    // Helices stored as structure of arrays, to be sampled all at once
+    // - the path t is measured in the transverse plane, as in EvaluateHelix()
+    // - the points of helix i are X/Y/Z[First_Point[i]] ... X/Y/Z[First_Point[i] + N_Points[i] - 1]
+    //
+    Int_t N = 0;                       // number of helices
+    std::vector<Double_t> XC;          // x-coordinate of the circle center, params[5]
+    std::vector<Double_t> YC;          // y-coordinate of the circle center, params[0]
+    std::vector<Double_t> Z0;          // z-coordinate at t = 0, params[1]
+    std::vector<Double_t> Phi0;        // phase at t = 0, params[2]
+    std::vector<Double_t> TgL;         // tangent of the dip angle, params[3]
+    std::vector<Double_t> C;           // curvature, params[4]
+    std::vector<Double_t> Path_Start;  // first sampled path
+    std::vector<Double_t> Path_End;    // last sampled path, where the helix leaves the TPC
+    std::vector<Int_t> First_Point;    // index of first sampled point
+    std::vector<Int_t> N_Points;       // number of sampled points
+    std::vector<Float_t> X;            // x-coordinate of sampled points
+    std::vector<Float_t> Y;            // y-coordinate of sampled points
+    std::vector<Float_t> Z;            // z-coordinate of sampled points
+};
+
+//_____________________________________________________________________________
+void EvaluateHelix(Double_t params[8], Double_t t, Double_t r[3]) {
+    //
+    // Calculate position of a point on a track and some derivatives at given phase
+    //
+    Double_t phase = params[4] * t + params[2];
+    Double_t sn = TMath::Sin(phase);
+    Double_t cs = TMath::Cos(phase);
+
+    r[0] = params[5] + sn / params[4];
+    r[1] = params[0] - cs / params[4];
+    r[2] = params[1] + params[3] * t;
+}
+
+//_____________________________________________________________________________
+void GetHelixParamsFromKine(Double_t x[3], Double_t p[3], Short_t charge, Double_t params[8]) {
+    //
+    // Returns helix parameters from kinematic input, Lorentz vector and vertex + charge
+    // Calculation of Helix parameters taken from http://alidoc.cern.ch/AliRoot/v5-09-36/_ali_helix_8cxx_source.html
+    //
+
+    // PENDING: is this a constant??
+    // magnetic field
+    Double_t b_field = 0.5;
+    Double_t b_fak = b_field * 3. / 1000.;
+
+    Double_t pt = TMath::Sqrt(p[0] * p[0] + p[1] * p[1]);
+    Double_t curvature = ((charge / pt) * b_fak);
+
+    params[4] = curvature;  // C
+    params[3] = p[2] / pt;  // tgl
+
+    Double_t rc = 1 / params[4];
+    Double_t xc = x[0] - rc * p[1] / pt;
+    Double_t yc = x[1] + rc * p[0] / pt;
+    params[5] = x[0];  // x0
+    params[0] = x[1];  // y0
+    params[1] = x[2];  // z0
+    params[5] = xc;
+    params[0] = yc;
+    params[6] = pt;
+    params[7] = p[2];
+
+    if (TMath::Abs(p[1]) < TMath::Abs(p[0])) {
+        params[2] = TMath::ASin(p[1] / pt);
+        if (charge * yc < charge * x[1]) {
+            params[2] = TMath::Pi() - params[2];
+        }
+    } else {
+        params[2] = TMath::ACos(p[0] / pt);
+        if (charge * xc > charge * x[0]) {
+            params[2] = -params[2];
+        }
+    }
+}
+
+//_____________________________________________________________________________
+void GetHelixDerivatives(Double_t params[8], Double_t t, Double_t r[3], Double_t dr[3], Double_t d2r[3]) {
+    //
+    // Calculate position, first and second derivatives of the helix w.r.t. the path
+    //
+    Double_t phase = params[4] * t + params[2];
+    Double_t sn = TMath::Sin(phase);
+    Double_t cs = TMath::Cos(phase);
+
+    r[0] = params[5] + sn / params[4];
+    r[1] = params[0] - cs / params[4];
+    r[2] = params[1] + params[3] * t;
+
+    dr[0] = cs;
+    dr[1] = sn;
+    dr[2] = params[3];
+
+    d2r[0] = -params[4] * sn;
+    d2r[1] = params[4] * cs;
+    d2r[2] = 0.;
+}
+
+//_____________________________________________________________________________
+Double_t GetHelixPathAtXY(Double_t params[8], Double_t x, Double_t y, Double_t target_path) {
+    //
+    // Return the path of the point of the helix whose transverse projection is closest to (x, y),
+    // choosing among the turns of the helix the one closest to target_path
+    //
+    Double_t sign = params[4] > 0. ? 1. : -1.;
+    Double_t phase = TMath::ATan2(sign * (x - params[5]), -sign * (y - params[0]));
+    Double_t path = (phase - params[2]) / params[4];
+    Double_t period = TMath::TwoPi() / TMath::Abs(params[4]);
+    return path + TMath::Nint((target_path - path) / period) * period;
+}
+
+//_____________________________________________________________________________
+Double_t GetDCAHelixToPoint(Double_t params[8], Double_t point[3], Double_t &path) {
+    //
+    // Return the distance of closest approach between a helix and a point, and the path where it happens
+    // (1) closed-form start: the point of the circle closest to the point in the transverse plane, on the turn closest in z
+    // (2) Newton refinement of d/dt |r(t) - point|^2 = 0 in 3D
+    //
+    Double_t target_path = TMath::Abs(params[3]) > 1E-6 ? (point[2] - params[1]) / params[3] : 0.;
+    Double_t start_path = GetHelixPathAtXY(params, point[0], point[1], target_path);
+    Double_t period = TMath::TwoPi() / TMath::Abs(params[4]);
+
+    Double_t r[3], dr[3], d2r[3];
+    Double_t min_dist = -1.;
+
+    // the minimum in 3D can move to a neighbouring turn when the helix is steep
+    for (Double_t this_path : {start_path - period, start_path, start_path + period}) {
+
+        for (Int_t iter = 0; iter < 20; iter++) {
+            GetHelixDerivatives(params, this_path, r, dr, d2r);
+            Double_t grad = (r[0] - point[0]) * dr[0] + (r[1] - point[1]) * dr[1] + (r[2] - point[2]) * dr[2];
+            Double_t hess = dr[0] * dr[0] + dr[1] * dr[1] + dr[2] * dr[2] +  //
+                            (r[0] - point[0]) * d2r[0] + (r[1] - point[1]) * d2r[1];
+            if (hess <= 0.) hess = 1. + params[3] * params[3];  // not near a minimum yet, do a gradient step
+            Double_t delta_path = -grad / hess;
+            this_path += delta_path;
+            if (TMath::Abs(delta_path) < 1E-6) break;
+        }
+
+        EvaluateHelix(params, this_path, r);
+        Double_t this_dist = TMath::Sqrt((r[0] - point[0]) * (r[0] - point[0]) +  //
+                                         (r[1] - point[1]) * (r[1] - point[1]) +  //
+                                         (r[2] - point[2]) * (r[2] - point[2]));
+        if (min_dist < 0. || this_dist < min_dist) {
+            min_dist = this_dist;
+            path = this_path;
+        }
+    }
+
+    return min_dist;
+}
+
+//_____________________________________________________________________________
+Double_t RefineDCAHelixToHelix(Double_t params_a[8], Double_t params_b[8], Double_t &path_a, Double_t &path_b) {
+    //
+    // Newton minimization of |r_a(t_a) - r_b(t_b)|^2, starting from (path_a, path_b); return the final distance
+    //
+    Double_t ra[3], dra[3], d2ra[3];
+    Double_t rb[3], drb[3], d2rb[3];
+    Double_t diff[3];
+
+    for (Int_t iter = 0; iter < 20; iter++) {
+        GetHelixDerivatives(params_a, path_a, ra, dra, d2ra);
+        GetHelixDerivatives(params_b, path_b, rb, drb, d2rb);
+        for (Int_t i = 0; i < 3; i++) diff[i] = ra[i] - rb[i];
+
+        Double_t grad_a = diff[0] * dra[0] + diff[1] * dra[1] + diff[2] * dra[2];
+        Double_t grad_b = -(diff[0] * drb[0] + diff[1] * drb[1] + diff[2] * drb[2]);
+        Double_t norm_a = dra[0] * dra[0] + dra[1] * dra[1] + dra[2] * dra[2];
+        Double_t norm_b = drb[0] * drb[0] + drb[1] * drb[1] + drb[2] * drb[2];
+        Double_t hess_aa = norm_a + diff[0] * d2ra[0] + diff[1] * d2ra[1];
+        Double_t hess_bb = norm_b - diff[0] * d2rb[0] - diff[1] * d2rb[1];
+        Double_t hess_ab = -(dra[0] * drb[0] + dra[1] * drb[1] + dra[2] * drb[2]);
+        Double_t det = hess_aa * hess_bb - hess_ab * hess_ab;
+
+        Double_t delta_a, delta_b;
+        if (hess_aa > 0. && det > 1E-12) {
+            delta_a = -(hess_bb * grad_a - hess_ab * grad_b) / det;
+            delta_b = -(hess_aa * grad_b - hess_ab * grad_a) / det;
+        } else {
+            // not near a minimum yet, do a gradient step
+            delta_a = -grad_a / norm_a;
+            delta_b = -grad_b / norm_b;
+        }
+        path_a += delta_a;
+        path_b += delta_b;
+        if (TMath::Abs(delta_a) < 1E-6 && TMath::Abs(delta_b) < 1E-6) break;
+    }
+
+    EvaluateHelix(params_a, path_a, ra);
+    EvaluateHelix(params_b, path_b, rb);
+    return TMath::Sqrt((ra[0] - rb[0]) * (ra[0] - rb[0]) + (ra[1] - rb[1]) * (ra[1] - rb[1]) + (ra[2] - rb[2]) * (ra[2] - rb[2]));
+}
+
+//_____________________________________________________________________________
+Double_t GetDCAHelixToHelix(Double_t params_a[8], Double_t params_b[8], Double_t &path_a, Double_t &path_b) {
+    //
+    // Return the distance of closest approach between two helices, and the paths where it happens
+    // (1) closed-form start: intersections of both circles in the transverse plane (or their closest points, if they don't cross),
+    //     on the turn of helix A closest to its reference point, and on the turn of helix B closest in z
+    // (2) Newton refinement in 3D, keeping the best of the starting points
+    //
+    Double_t radius_a = 1. / TMath::Abs(params_a[4]);
+    Double_t radius_b = 1. / TMath::Abs(params_b[4]);
+    Double_t ux = params_b[5] - params_a[5];
+    Double_t uy = params_b[0] - params_a[0];
+    Double_t center_dist = TMath::Sqrt(ux * ux + uy * uy);
+    if (center_dist > 1E-9) {
+        ux /= center_dist;
+        uy /= center_dist;
+    } else {
+        ux = 1.;
+        uy = 0.;
+    }
+
+    // transverse points where to start, for each helix
+    std::vector<std::array<Double_t, 4>> start_points;
+    if (center_dist <= radius_a + radius_b && center_dist >= TMath::Abs(radius_a - radius_b)) {
+        // both circles cross
+        Double_t along = (radius_a * radius_a - radius_b * radius_b + center_dist * center_dist) / (2. * center_dist);
+        Double_t across = TMath::Sqrt(TMath::Max(radius_a * radius_a - along * along, 0.));
+        for (Double_t side : {-1., 1.}) {
+            Double_t x = params_a[5] + along * ux - side * across * uy;
+            Double_t y = params_a[0] + along * uy + side * across * ux;
+            start_points.push_back({x, y, x, y});
+        }
+    } else {
+        // the circles are apart, or one inside the other: closest points lie on the line between centers
+        Double_t dir_b = center_dist > radius_a + radius_b ? -1. : (radius_a > radius_b ? 1. : -1.);
+        Double_t dir_a = center_dist > radius_a + radius_b ? 1. : dir_b;
+        start_points.push_back({params_a[5] + dir_a * radius_a * ux, params_a[0] + dir_a * radius_a * uy,  //
+                                params_b[5] + dir_b * radius_b * ux, params_b[0] + dir_b * radius_b * uy});
+    }
+
+    Double_t min_dist = -1.;
+    for (auto &this_start : start_points) {
+        Double_t this_path_a = GetHelixPathAtXY(params_a, this_start[0], this_start[1], 0.);
+        Double_t this_z_a = params_a[1] + params_a[3] * this_path_a;
+        Double_t target_path_b = TMath::Abs(params_b[3]) > 1E-6 ? (this_z_a - params_b[1]) / params_b[3] : 0.;
+        Double_t this_path_b = GetHelixPathAtXY(params_b, this_start[2], this_start[3], target_path_b);
+
+        Double_t this_dist = RefineDCAHelixToHelix(params_a, params_b, this_path_a, this_path_b);
+        if (min_dist < 0. || this_dist < min_dist) {
+            min_dist = this_dist;
+            path_a = this_path_a;
+            path_b = this_path_b;
+        }
+    }
+
+    return min_dist;
+}
+
+//_____________________________________________________________________________
+Double_t GetDCALineToLine(Double_t x_a[3], Double_t p_a[3], Double_t x_b[3], Double_t p_b[3], Double_t vertex[3]) {
+    //
+    // Return the distance of closest approach between two straight lines (neutral particles), given a point and a direction each,
+    // and store in vertex the midpoint between the closest points
+    //
+    Double_t w[3] = {x_a[0] - x_b[0], x_a[1] - x_b[1], x_a[2] - x_b[2]};
+    Double_t aa = p_a[0] * p_a[0] + p_a[1] * p_a[1] + p_a[2] * p_a[2];
+    Double_t bb = p_b[0] * p_b[0] + p_b[1] * p_b[1] + p_b[2] * p_b[2];
+    Double_t ab = p_a[0] * p_b[0] + p_a[1] * p_b[1] + p_a[2] * p_b[2];
+    Double_t aw = p_a[0] * w[0] + p_a[1] * w[1] + p_a[2] * w[2];
+    Double_t bw = p_b[0] * w[0] + p_b[1] * w[1] + p_b[2] * w[2];
+    Double_t det = aa * bb - ab * ab;
+
+    // parallel lines: any point works, take the one of line A
+    Double_t s_a = det > 1E-12 ? (ab * bw - bb * aw) / det : 0.;
+    Double_t s_b = det > 1E-12 ? (aa * bw - ab * aw) / det : bw / bb;
+
+    Double_t dist2 = 0.;
+    for (Int_t i = 0; i < 3; i++) {
+        Double_t point_a = x_a[i] + s_a * p_a[i];
+        Double_t point_b = x_b[i] + s_b * p_b[i];
+        vertex[i] = 0.5 * (point_a + point_b);
+        dist2 += (point_a - point_b) * (point_a - point_b);
+    }
+
+    return TMath::Sqrt(dist2);
+}
+
+//_____________________________________________________________________________
+Double_t GetTPCExitPath(Double_t params[8], Double_t path_start, Double_t max_length) {
+    //
+    // Return the first path after path_start where the helix leaves the TPC cylinder (r <= TPC_MAX_RADIUS, |z| <= TPC_MAX_Z),
+    // solved analytically instead of stepping along the track, and limited to path_start + max_length
+    //
+    Double_t pos[3];
+    EvaluateHelix(params, path_start, pos);
+    if (pos[0] * pos[0] + pos[1] * pos[1] > TPC_MAX_RADIUS * TPC_MAX_RADIUS || TMath::Abs(pos[2]) > TPC_MAX_Z) {
+        return path_start;
+    }
+
+    Double_t path_exit = path_start + max_length;
+
+    // (1) endcaps: z is linear in the path
+    if (params[3] > 0.) path_exit = TMath::Min(path_exit, (TPC_MAX_Z - params[1]) / params[3]);
+    if (params[3] < 0.) path_exit = TMath::Min(path_exit, (-TPC_MAX_Z - params[1]) / params[3]);
+
+    // (2) outer radius: in the transverse plane, r^2 = D^2 + 1/C^2 + (2/C) D sin(phase - alpha),
+    // where D and alpha are the polar coordinates of the circle center
+    Double_t curvature = params[4];
+    Double_t center_dist = TMath::Sqrt(params[5] * params[5] + params[0] * params[0]);
+    if (center_dist < 1E-9) return path_exit;  // circle around the beam axis, radius never changes
+
+    Double_t sin_arg = curvature * (TPC_MAX_RADIUS * TPC_MAX_RADIUS - center_dist * center_dist - 1. / (curvature * curvature)) /
+                       (2. * center_dist);
+    if (TMath::Abs(sin_arg) > 1.) return path_exit;  // the circle never reaches the outer radius
+
+    Double_t alpha = TMath::ATan2(params[0], params[5]);
+    Double_t period = TMath::TwoPi() / TMath::Abs(curvature);
+    for (Double_t phase : {alpha + TMath::ASin(sin_arg), alpha + TMath::Pi() - TMath::ASin(sin_arg)}) {
+        // bring the crossing to the first turn after path_start
+        Double_t delta_path = std::fmod((phase - params[2]) / curvature - path_start, period);
+        if (delta_path < 0.) delta_path += period;
+        path_exit = TMath::Min(path_exit, path_start + delta_path);
+    }
+
+    return path_exit;
+}
+
+//_____________________________________________________________________________
+Double_t GetHelixStep(Double_t curvature, Double_t tolerance) {
+    //
+    // Return the largest step whose chord deviates at most by tolerance from the helix,
+    // from the sagitta of an arc of length L on a circle of curvature C: s = C L^2 / 8
+    //
+    Double_t step = TMath::Sqrt(8. * tolerance / TMath::Max(TMath::Abs(curvature), 1E-12));
+    return TMath::Min(TMath::Max(step, HELIX_MIN_STEP), HELIX_MAX_STEP);
+}
+
+//_____________________________________________________________________________
+void ClearHelixBatch(HelixBatch_tt &batch) {
+    //
+    // Remove all helices, keeping the allocated memory for the next batch
+    //
+    batch.N = 0;
+    batch.XC.clear();
+    batch.YC.clear();
+    batch.Z0.clear();
+    batch.Phi0.clear();
+    batch.TgL.clear();
+    batch.C.clear();
+    batch.Path_Start.clear();
+    batch.Path_End.clear();
+    batch.First_Point.clear();
+    batch.N_Points.clear();
+    batch.X.clear();
+    batch.Y.clear();
+    batch.Z.clear();
+}
+
+//_____________________________________________________________________________
+Int_t AddHelixToBatch(HelixBatch_tt &batch, Double_t params[8], Double_t path_start, Double_t max_length) {
+    //
+    // Add a helix to be sampled from path_start until it leaves the TPC (or after max_length), return its index
+    //
+    batch.XC.push_back(params[5]);
+    batch.YC.push_back(params[0]);
+    batch.Z0.push_back(params[1]);
+    batch.Phi0.push_back(params[2]);
+    batch.TgL.push_back(params[3]);
+    batch.C.push_back(params[4]);
+    batch.Path_Start.push_back(path_start);
+    batch.Path_End.push_back(GetTPCExitPath(params, path_start, max_length));
+    return batch.N++;
+}
+
+//_____________________________________________________________________________
+void SampleHelixBatch(HelixBatch_tt &batch, Double_t tolerance = HELIX_TOLERANCE) {
+    //
+    // Sample all helices of the batch, with a step adapted to the curvature of each one
+    //
+
+    // (1) count points and assign their place in the output arrays
+    batch.First_Point.resize(batch.N);
+    batch.N_Points.resize(batch.N);
+
+    Int_t n_total_points = 0;
+    for (Int_t i = 0; i < batch.N; i++) {
+        Double_t path_length = batch.Path_End[i] - batch.Path_Start[i];
+        Int_t n_steps = (Int_t)TMath::Ceil(path_length / GetHelixStep(batch.C[i], tolerance));
+        batch.First_Point[i] = n_total_points;
+        batch.N_Points[i] = TMath::Max(n_steps, 1) + 1;
+        n_total_points += batch.N_Points[i];
+    }
+
+    batch.X.resize(n_total_points);
+    batch.Y.resize(n_total_points);
+    batch.Z.resize(n_total_points);
+
+    // (2) evaluate the points, the inner loop has no branches so that it can be vectorized
+    for (Int_t i = 0; i < batch.N; i++) {
+        const Double_t xc = batch.XC[i];
+        const Double_t yc = batch.YC[i];
+        const Double_t z0 = batch.Z0[i];
+        const Double_t phi0 = batch.Phi0[i];
+        const Double_t tgl = batch.TgL[i];
+        const Double_t c = batch.C[i];
+        const Double_t inv_c = 1. / c;
+        const Double_t path_start = batch.Path_Start[i];
+        const Double_t step = (batch.Path_End[i] - path_start) / (batch.N_Points[i] - 1);
+        const Int_t n_points = batch.N_Points[i];
+        Float_t *x = batch.X.data() + batch.First_Point[i];
+        Float_t *y = batch.Y.data() + batch.First_Point[i];
+        Float_t *z = batch.Z.data() + batch.First_Point[i];
+        for (Int_t j = 0; j < n_points; j++) {
+            Double_t t = path_start + j * step;
+            Double_t phase = c * t + phi0;
+            x[j] = xc + std::sin(phase) * inv_c;
+            y[j] = yc - std::cos(phase) * inv_c;
+            z[j] = z0 + tgl * t;
+        }
+    }
+}
+
+//_____________________________________________________________________________
+void SetHelixPoints(TEveLine *line, HelixBatch_tt &batch, Int_t i) {
+    //
+    // Fill a line with the sampled points of helix i
+    //
+    line->Reset(batch.N_Points[i]);
+    for (Int_t j = batch.First_Point[i]; j < batch.First_Point[i] + batch.N_Points[i]; j++) {
+        line->SetNextPoint(batch.X[j], batch.Y[j], batch.Z[j]);
+    }
+}
+
+//_____________________________________________________________________________
+void SampleHelix(TEveLine *line, Double_t params[8], Double_t path_start, Double_t max_length) {
+    //
+    // Fill a line with a single helix, from path_start until it leaves the TPC (or after max_length)
+    //
+    static HelixBatch_tt single_helix;
+    ClearHelixBatch(single_helix);
+    AddHelixToBatch(single_helix, params, path_start, max_length);
+    SampleHelixBatch(single_helix);
+    SetHelixPoints(line, single_helix, 0);
+}
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef INDEX_FUNCTIONS_HXX
+#define INDEX_FUNCTIONS_HXX
+
+// the index key is split in two 64-bit halves, as stored by TTreeIndex:
+// - major: (RunNumber, DirNumber, Event)
+// - minor: (Idx_V0A, Idx_V0B)
+#define INDEX_MAJOR "(RunNumber * 1000 + DirNumber) * 100000 + Event"
+#define INDEX_MINOR "Idx_V0A * 100000 + Idx_V0B"
+
+//_____________________________________________________________________________
+Bool_t IsRemoteFile(TString input_filename) {
+    return input_filename.BeginsWith("root://") || input_filename.BeginsWith("http://") || input_filename.BeginsWith("https://");
+}
+
+//_____________________________________________________________________________
+TString GetIndexFilename(TString input_filename) {
+    //
+    // Name of the sidecar file that stores the index of an output file
+    // e.g. "SexaquarkResults_CustomV0s_246178_000.root" -> "SexaquarkResults_CustomV0s_246178_000_index.root"
+    // Remote files can't have a sidecar next to them, theirs goes into the local cache of cache.sh instead,
+    // e.g. "root://host//path/246178/SexaquarkResults_CustomV0s_000.root" -> "$CACHE_DIR/246178/SexaquarkResults_CustomV0s_000_index.root"
+    //
+    TString index_filename = input_filename;
+    if (IsRemoteFile(input_filename)) {
+        TString cache_dir = gSystem->Getenv("CACHE_DIR") ? TString(gSystem->Getenv("CACHE_DIR"))  //
+                                                         : TString(gSystem->HomeDirectory()) + "/.cache/event_display";
+        TString run_dir = gSystem->BaseName(gSystem->GetDirName(input_filename));
+        gSystem->mkdir(cache_dir + "/" + run_dir, kTRUE);
+        index_filename = cache_dir + "/" + run_dir + "/" + gSystem->BaseName(input_filename);
+    }
+    if (index_filename.EndsWith(".root")) index_filename.Remove(index_filename.Length() - 5);
+    return index_filename + "_index.root";
+}
+
+//_____________________________________________________________________________
+TTreeIndex *LoadCandidateIndex(TTree *this_tree, TString input_filename) {
+    //
+    // Attach an index over (RunNumber, DirNumber, Event, Idx_V0A, Idx_V0B) to this tree
+    // The index is read from a sidecar file if it's up to date, otherwise it's built once and stored there
+    //
+    TString index_filename = GetIndexFilename(input_filename);
+
+    // remote files can't be stat'ed, then the index is trusted while its number of entries matches the tree
+    FileStat_t input_stat, index_stat;
+    Bool_t index_is_valid = !gSystem->GetPathInfo(index_filename, index_stat) &&  //
+                            (IsRemoteFile(input_filename) ||                      //
+                             (!gSystem->GetPathInfo(input_filename, input_stat) && index_stat.fMtime >= input_stat.fMtime));
+
+    TTreeIndex *this_index = nullptr;
+
+    if (index_is_valid) {
+        TFile index_file(index_filename, "READ");
+        this_index = (TTreeIndex *)index_file.Get("SexaquarksIndex");
+        if (this_index && this_index->GetN() == this_tree->GetEntries()) {
+            this_index->SetTree(this_tree);
+            this_tree->SetTreeIndex(this_index);
+            printf("LoadCandidateIndex :: Index read from %s\n", index_filename.Data());
+            return this_index;
+        }
+        delete this_index;
+    }
+
+    // (debug)
+    printf("LoadCandidateIndex :: Building index for %s\n", input_filename.Data());
+
+    this_tree->BuildIndex(INDEX_MAJOR, INDEX_MINOR);
+    this_index = (TTreeIndex *)this_tree->GetTreeIndex();
+
+    // store it for the next sessions, if the directory is writable
+    TFile index_file(index_filename, "RECREATE");
+    if (!index_file.IsZombie()) {
+        index_file.WriteObject(this_index, "SexaquarksIndex");
+        printf("LoadCandidateIndex :: Index stored in %s\n", index_filename.Data());
+    }
+
+    return this_index;
+}
+
+//_____________________________________________________________________________
+void FindEntriesWithKey(TTreeIndex *this_index, Long64_t major, Long64_t minor, std::vector<Long64_t> &entries) {
+    //
+    // Append all entries matching (major, minor), by binary search over the sorted index values
+    //
+    Long64_t n = this_index->GetN();
+    const Long64_t *values_major = this_index->GetIndexValues();
+    const Long64_t *values_minor = this_index->GetIndexValuesMinor();
+    const Long64_t *index = this_index->GetIndex();
+
+    Long64_t lo = 0;
+    Long64_t hi = n;
+    while (lo < hi) {
+        Long64_t mid = (lo + hi) / 2;
+        if (values_major[mid] < major || (values_major[mid] == major && values_minor[mid] < minor)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    for (Long64_t i = lo; i < n && values_major[i] == major && values_minor[i] == minor; i++) {
+        entries.push_back(index[i]);
+    }
+}
+
+//_____________________________________________________________________________
+std::vector<Long64_t> FindCandidates(TTreeIndex *this_index, Int_t run_number, Int_t dir_number, Int_t event, Int_t idx_v0a,
+                                     Int_t idx_v0b) {
+    //
+    // Return the (sorted) entries of the candidates formed by V0s idx_v0a and idx_v0b, in any order
+    //
+    std::vector<Long64_t> entries;
+
+    Long64_t major = ((Long64_t)run_number * 1000 + dir_number) * 100000 + event;
+    FindEntriesWithKey(this_index, major, (Long64_t)idx_v0a * 100000 + idx_v0b, entries);
+    if (idx_v0a != idx_v0b) FindEntriesWithKey(this_index, major, (Long64_t)idx_v0b * 100000 + idx_v0a, entries);
+
+    std::sort(entries.begin(), entries.end());
+
+    return entries;
+}
+
+//_____________________________________________________________________________
+std::vector<Long64_t> FindSexaquarkCandidates(TChain *input_chain, Int_t input_run_number, Int_t input_dir_number,  //
+                                              Int_t input_event, Int_t input_v0a, Int_t input_v0b) {
+    //
+    // Look up the requested candidates in the index of each file, and convert them into chain entries
+    // When run and dir numbers are negative, they're taken from the first entry of each file
+    //
+    std::vector<Long64_t> selected_candidates;
+
+    input_chain->GetEntries();  // fills the tree offsets
+
+    for (Int_t tree_number = 0; tree_number < input_chain->GetNtrees(); tree_number++) {
+
+        Long64_t tree_offset = input_chain->GetTreeOffset()[tree_number];
+        input_chain->LoadTree(tree_offset);
+        TTree *this_tree = input_chain->GetTree();
+
+        Int_t this_run_number = input_run_number;
+        Int_t this_dir_number = input_dir_number;
+        if (this_run_number < 0 || this_dir_number < 0) {
+            this_tree->GetBranch("RunNumber")->GetEntry(0);
+            this_tree->GetBranch("DirNumber")->GetEntry(0);
+            if (this_run_number < 0) this_run_number = (Int_t)this_tree->GetLeaf("RunNumber")->GetValue();
+            if (this_dir_number < 0) this_dir_number = (Int_t)this_tree->GetLeaf("DirNumber")->GetValue();
+        }
+
+        TTreeIndex *this_index = LoadCandidateIndex(this_tree, input_chain->GetFile()->GetName());
+
+        for (Long64_t entry : FindCandidates(this_index, this_run_number, this_dir_number, input_event, input_v0a, input_v0b)) {
+            selected_candidates.push_back(tree_offset + entry);
+        }
+    }
+
+    return selected_candidates;
+}
+
+#endif
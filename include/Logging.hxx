@@ -0,0 +1,80 @@
+#ifndef LOGGING_HXX
+#define LOGGING_HXX
+
+// verbosity of the messages:
+// - 0: errors only
+// - 1: info, once per file, event or candidate
+// - 2: debug, once per particle, inside the draw loops
+// LOG_LEVEL is the highest level compiled in, e.g. `root -e '#define LOG_LEVEL 1' ...` drops the debug prints entirely,
+// gLogLevel selects the level at runtime, up to LOG_LEVEL
+#ifndef LOG_LEVEL
+#define LOG_LEVEL 2
+#endif
+
+Int_t gLogLevel = 1;
+
+#define LOG_INFO(...)                                              \
+    do {                                                           \
+        if (LOG_LEVEL >= 1 && gLogLevel >= 1) printf(__VA_ARGS__); \
+    } while (0)
+
+#define LOG_DEBUG(...)                                             \
+    do {                                                           \
+        if (LOG_LEVEL >= 2 && gLogLevel >= 2) printf(__VA_ARGS__); \
+    } while (0)
+
+//_____________________________________________________________________________
+struct Timer_tt {
+    //
+    // Accumulated time of one phase of the display
+    //
+    Double_t RealTime = 0.;  // [s]
+    Double_t CpuTime = 0.;   // [s]
+    Long64_t Calls = 0;      // number of timed scopes
+};
+
+//_____________________________________________________________________________
+std::map<TString, Timer_tt> &GetTimers() {
+    static std::map<TString, Timer_tt> timers;
+    return timers;
+}
+
+//_____________________________________________________________________________
+class ScopedTimer {
+    //
+    // Time the enclosing scope, and add it to the timer of this name
+    //
+   public:
+    ScopedTimer(const char *name) : fTimer(GetTimers()[name]) { fStopwatch.Start(); }
+
+    ~ScopedTimer() {
+        fStopwatch.Stop();
+        fTimer.RealTime += fStopwatch.RealTime();
+        fTimer.CpuTime += fStopwatch.CpuTime();
+        fTimer.Calls++;
+    }
+
+   private:
+    Timer_tt &fTimer;
+    TStopwatch fStopwatch;
+};
+
+//_____________________________________________________________________________
+void ResetTimers() {
+    GetTimers().clear();
+}
+
+//_____________________________________________________________________________
+void PrintTimers() {
+    //
+    // Print the accumulated time of every phase, nested phases are also included in the phases that contain them
+    //
+    printf("PrintTimers :: %-24s %10s %12s %12s %12s\n", "Phase", "Calls", "Real [ms]", "CPU [ms]", "Real/Call [us]");
+    for (auto &timer : GetTimers()) {
+        printf("PrintTimers :: %-24s %10lld %12.2f %12.2f %12.2f\n", timer.first.Data(), timer.second.Calls,  //
+               1.e3 * timer.second.RealTime, 1.e3 * timer.second.CpuTime,                                     //
+               timer.second.Calls ? 1.e6 * timer.second.RealTime / timer.second.Calls : 0.);
+    }
+}
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef SHAPE_FUNCTIONS_HXX
+#define SHAPE_FUNCTIONS_HXX
+
+// full ALICE geometry, and the cache that stores only the displayed TPC shell
+#define GEOMETRY_FILENAME "alice.root"
+#define GEOMETRY_CACHE_FILENAME "alice_tpc.root"
+#define GEOMETRY_CACHE_NAME "TPC"
+#define GEOMETRY_NODE "TPC_M_1"
+#define GEOMETRY_COLOR kGray
+#define GEOMETRY_TRANSPARENCY 70.  // 0..100, larger values make it more transparent
+
+//_____________________________________________________________________________
+TEveGeoShapeExtract *ExtractTPCShape(TString geometry_filename = GEOMETRY_FILENAME) {
+    //
+    // Import the full geometry and keep only the shape of the TPC shell, without its daughters
+    // The extract references the shape of gGeoManager, so the geometry is not deleted afterwards
+    //
+    if (!TGeoManager::Import(geometry_filename)) {
+        printf("ExtractTPCShape :: ERROR: couldn't import %s\n", geometry_filename.Data());
+        return nullptr;
+    }
+
+    TGeoNode *node = gGeoManager->GetTopVolume()->FindNode(GEOMETRY_NODE);
+    if (!node) {
+        printf("ExtractTPCShape :: ERROR: node %s not found in %s\n", GEOMETRY_NODE, geometry_filename.Data());
+        return nullptr;
+    }
+
+    TEveTrans aux_trans;
+    aux_trans.SetFrom(*node->GetMatrix());
+
+    Float_t aux_rgba[4] = {1., 1., 1., 1.};
+    if (TColor *color = gROOT->GetColor(GEOMETRY_COLOR)) color->GetRGB(aux_rgba[0], aux_rgba[1], aux_rgba[2]);
+    aux_rgba[3] = 1. - GEOMETRY_TRANSPARENCY / 100.;
+
+    TEveGeoShapeExtract *extract = new TEveGeoShapeExtract(node->GetName(), node->GetVolume()->GetName());
+    extract->SetTrans(aux_trans.Array());
+    extract->SetRGBA(aux_rgba);
+    extract->SetRGBALine(aux_rgba);
+    extract->SetRnrSelf(kTRUE);
+    extract->SetRnrElements(kFALSE);
+    extract->SetShape(node->GetVolume()->GetShape());
+
+    return extract;
+}
+
+//_____________________________________________________________________________
+void StoreGeometryCache(TEveGeoShapeExtract *geometry_extract, TString cache_filename = GEOMETRY_CACHE_FILENAME) {
+    //
+    // Write the extract into the cache file, if the directory is writable
+    //
+    TFile cache_file(cache_filename, "RECREATE");
+    if (cache_file.IsZombie()) return;
+
+    cache_file.WriteObject(geometry_extract, GEOMETRY_CACHE_NAME);
+    printf("StoreGeometryCache :: Geometry stored in %s\n", cache_filename.Data());
+}
+
+//_____________________________________________________________________________
+TEveGeoShapeExtract *LoadGeometryCache(TString cache_filename = GEOMETRY_CACHE_FILENAME, TString geometry_filename = GEOMETRY_FILENAME) {
+    //
+    // Return the displayed TPC shell, read once per session from the cache file
+    // If the cache doesn't exist or is older than the full geometry, it's extracted again and stored
+    //
+    static TEveGeoShapeExtract *geometry_extract = nullptr;
+    if (geometry_extract) return geometry_extract;
+
+    FileStat_t geometry_stat, cache_stat;
+    Bool_t cache_is_valid = !gSystem->GetPathInfo(cache_filename, cache_stat) &&  //
+                            (gSystem->GetPathInfo(geometry_filename, geometry_stat) || cache_stat.fMtime >= geometry_stat.fMtime);
+
+    if (cache_is_valid) {
+        TFile cache_file(cache_filename, "READ");
+        geometry_extract = (TEveGeoShapeExtract *)cache_file.Get(GEOMETRY_CACHE_NAME);
+        if (geometry_extract) {
+            printf("LoadGeometryCache :: Geometry read from %s\n", cache_filename.Data());
+            return geometry_extract;
+        }
+    }
+
+    // (debug)
+    printf("LoadGeometryCache :: Extracting geometry from %s\n", geometry_filename.Data());
+
+    geometry_extract = ExtractTPCShape(geometry_filename);
+    if (geometry_extract) StoreGeometryCache(geometry_extract, cache_filename);
+
+    return geometry_extract;
+}
+
+#endif
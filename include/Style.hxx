@@ -1,6 +1,8 @@
 #ifndef STYLE_HXX
 #define STYLE_HXX
 
+#define LINE_WIDTH 2  // 4 for presentation purposes, 2 for development
+
 Color_t myRed = kRed + 1;
 Color_t myGreen = kSpring - 8;
 Color_t myBlue = kAzure + 2;
@@ -78,75 +78,302 @@ struct Event_tt {
     std::vector<Float_t>* V0_DCA_wrtPV = 0;      // distance of closest approach to Primary Vertex
 };
 
+// groups of branches of the Events tree, so that each view reads only what it draws
+#define BRANCHES_MC (1 << 0)        // MC particles: kinematics, vertices, PID and daughters
+#define BRANCHES_REC (1 << 1)       // reconstructed tracks: kinematics and helix parameters
+#define BRANCHES_V0 (1 << 2)        // V0s: daughters, vertex, momenta and DCA between daughters
+#define BRANCHES_ANALYSIS (1 << 3)  // MC family, PID, quality and topological variables of tracks and V0s
+#define BRANCHES_ALL (BRANCHES_MC | BRANCHES_REC | BRANCHES_V0 | BRANCHES_ANALYSIS)
+
+//________________________________________________________________________
+template <typename T>
+void EnableBranch(TTree* this_tree, const char* branch_name, T* address) {
+    this_tree->SetBranchStatus(branch_name, 1);
+    this_tree->SetBranchAddress(branch_name, address);
+}
+
+//________________________________________________________________________
+void LoadBranches(TTree* this_tree, Event_tt& this_event, Int_t branches = BRANCHES_ALL) {
+    //
+    // Read only the groups of branches given by the bitmask branches, the rest are disabled
+    // The vectors are allocated by ROOT on the first call, and reused for every entry of this tree
+    // They belong to the tree: once its file is closed, call ResetEvent() before loading the branches of another tree
+    //
+    this_tree->SetBranchStatus("*", 0);
+
+    if (branches & BRANCHES_MC) {
+        EnableBranch(this_tree, "N_MCGen", &this_event.N_MCGen);
+        EnableBranch(this_tree, "MC_Px", &this_event.MC_Px);
+        EnableBranch(this_tree, "MC_Py", &this_event.MC_Py);
+        EnableBranch(this_tree, "MC_Pz", &this_event.MC_Pz);
+        EnableBranch(this_tree, "MC_X", &this_event.MC_X);
+        EnableBranch(this_tree, "MC_Y", &this_event.MC_Y);
+        EnableBranch(this_tree, "MC_Z", &this_event.MC_Z);
+        EnableBranch(this_tree, "MC_Xf", &this_event.MC_Xf);
+        EnableBranch(this_tree, "MC_Yf", &this_event.MC_Yf);
+        EnableBranch(this_tree, "MC_Zf", &this_event.MC_Zf);
+        EnableBranch(this_tree, "MC_PID", &this_event.MC_PID);
+        EnableBranch(this_tree, "MC_NDaughters", &this_event.MC_NDaughters);
+        EnableBranch(this_tree, "MC_FirstDau", &this_event.MC_FirstDau);
+        EnableBranch(this_tree, "MC_LastDau", &this_event.MC_LastDau);
+        EnableBranch(this_tree, "MC_isSignal", &this_event.MC_isSignal);
+    }
+
+    if (branches & BRANCHES_REC) {
+        EnableBranch(this_tree, "N_MCRec", &this_event.N_MCRec);
+        EnableBranch(this_tree, "Idx_True", &this_event.Idx_True);
+        EnableBranch(this_tree, "Rec_Px", &this_event.Rec_Px);
+        EnableBranch(this_tree, "Rec_Py", &this_event.Rec_Py);
+        EnableBranch(this_tree, "Rec_Pz", &this_event.Rec_Pz);
+        EnableBranch(this_tree, "Rec_Charge", &this_event.Rec_Charge);
+        EnableBranch(this_tree, "Rec_isSignal", &this_event.Rec_isSignal);
+        EnableBranch(this_tree, "Rec_HelixParam0", &this_event.Rec_HelixParam0);
+        EnableBranch(this_tree, "Rec_HelixParam1", &this_event.Rec_HelixParam1);
+        EnableBranch(this_tree, "Rec_HelixParam2", &this_event.Rec_HelixParam2);
+        EnableBranch(this_tree, "Rec_HelixParam3", &this_event.Rec_HelixParam3);
+        EnableBranch(this_tree, "Rec_HelixParam4", &this_event.Rec_HelixParam4);
+        EnableBranch(this_tree, "Rec_HelixParam5", &this_event.Rec_HelixParam5);
+    }
+
+    if (branches & BRANCHES_V0) {
+        EnableBranch(this_tree, "N_V0s", &this_event.N_V0s);
+        EnableBranch(this_tree, "Idx_Pos", &this_event.Idx_Pos);
+        EnableBranch(this_tree, "Idx_Neg", &this_event.Idx_Neg);
+        EnableBranch(this_tree, "V0_Px", &this_event.V0_Px);
+        EnableBranch(this_tree, "V0_Py", &this_event.V0_Py);
+        EnableBranch(this_tree, "V0_Pz", &this_event.V0_Pz);
+        EnableBranch(this_tree, "V0_X", &this_event.V0_X);
+        EnableBranch(this_tree, "V0_Y", &this_event.V0_Y);
+        EnableBranch(this_tree, "V0_Z", &this_event.V0_Z);
+        EnableBranch(this_tree, "Pos_Px", &this_event.Pos_Px);
+        EnableBranch(this_tree, "Pos_Py", &this_event.Pos_Py);
+        EnableBranch(this_tree, "Pos_Pz", &this_event.Pos_Pz);
+        EnableBranch(this_tree, "Neg_Px", &this_event.Neg_Px);
+        EnableBranch(this_tree, "Neg_Py", &this_event.Neg_Py);
+        EnableBranch(this_tree, "Neg_Pz", &this_event.Neg_Pz);
+        EnableBranch(this_tree, "V0_isSignal", &this_event.V0_isSignal);
+        EnableBranch(this_tree, "V0_DCA_Daughters", &this_event.V0_DCA_Daughters);
+    }
+
+    if (branches & BRANCHES_ANALYSIS) {
+        EnableBranch(this_tree, "MC_Mother", &this_event.MC_Mother);
+        EnableBranch(this_tree, "MC_Status", &this_event.MC_Status);
+        EnableBranch(this_tree, "Rec_IP_wrtPV", &this_event.Rec_IP_wrtPV);
+        EnableBranch(this_tree, "Rec_NSigmaPion", &this_event.Rec_NSigmaPion);
+        EnableBranch(this_tree, "Rec_NSigmaProton", &this_event.Rec_NSigmaProton);
+        EnableBranch(this_tree, "Rec_NClustersTPC", &this_event.Rec_NClustersTPC);
+        EnableBranch(this_tree, "Rec_isDuplicate", &this_event.Rec_isDuplicate);
+        EnableBranch(this_tree, "Rec_isSimilar", &this_event.Rec_isSimilar);
+        EnableBranch(this_tree, "V0_E_asK0", &this_event.V0_E_asK0);
+        EnableBranch(this_tree, "V0_E_asAL", &this_event.V0_E_asAL);
+        EnableBranch(this_tree, "V0_couldBeK0", &this_event.V0_couldBeK0);
+        EnableBranch(this_tree, "V0_couldBeAL", &this_event.V0_couldBeAL);
+        EnableBranch(this_tree, "V0_Chi2", &this_event.V0_Chi2);
+        EnableBranch(this_tree, "V0_IP_wrtPV", &this_event.V0_IP_wrtPV);
+        EnableBranch(this_tree, "V0_CPA_wrtPV", &this_event.V0_CPA_wrtPV);
+        EnableBranch(this_tree, "V0_ArmAlpha", &this_event.V0_ArmAlpha);
+        EnableBranch(this_tree, "V0_ArmPt", &this_event.V0_ArmPt);
+        EnableBranch(this_tree, "V0_DecayLength", &this_event.V0_DecayLength);
+        EnableBranch(this_tree, "V0_DCA_wrtPV", &this_event.V0_DCA_wrtPV);
+    }
+}
+
 //________________________________________________________________________
-void LoadBranches(TTree* this_tree, Event_tt& this_event) {
-    /* MC particles */
-    this_tree->SetBranchAddress("N_MCGen", &this_event.N_MCGen);
-    this_tree->SetBranchAddress("MC_Px", &this_event.MC_Px);
-    this_tree->SetBranchAddress("MC_Py", &this_event.MC_Py);
-    this_tree->SetBranchAddress("MC_Pz", &this_event.MC_Pz);
-    this_tree->SetBranchAddress("MC_X", &this_event.MC_X);
-    this_tree->SetBranchAddress("MC_Y", &this_event.MC_Y);
-    this_tree->SetBranchAddress("MC_Z", &this_event.MC_Z);
-    this_tree->SetBranchAddress("MC_Xf", &this_event.MC_Xf);
-    this_tree->SetBranchAddress("MC_Yf", &this_event.MC_Yf);
-    this_tree->SetBranchAddress("MC_Zf", &this_event.MC_Zf);
-    this_tree->SetBranchAddress("MC_PID", &this_event.MC_PID);
-    this_tree->SetBranchAddress("MC_Mother", &this_event.MC_Mother);
-    this_tree->SetBranchAddress("MC_NDaughters", &this_event.MC_NDaughters);
-    this_tree->SetBranchAddress("MC_FirstDau", &this_event.MC_FirstDau);
-    this_tree->SetBranchAddress("MC_LastDau", &this_event.MC_LastDau);
-    this_tree->SetBranchAddress("MC_Status", &this_event.MC_Status);
-    this_tree->SetBranchAddress("MC_isSignal", &this_event.MC_isSignal);
-    /* MC Rec Tracks */
-    this_tree->SetBranchAddress("N_MCRec", &this_event.N_MCRec);
-    this_tree->SetBranchAddress("Idx_True", &this_event.Idx_True);
-    this_tree->SetBranchAddress("Rec_Px", &this_event.Rec_Px);
-    this_tree->SetBranchAddress("Rec_Py", &this_event.Rec_Py);
-    this_tree->SetBranchAddress("Rec_Pz", &this_event.Rec_Pz);
-    this_tree->SetBranchAddress("Rec_Charge", &this_event.Rec_Charge);
-    this_tree->SetBranchAddress("Rec_IP_wrtPV", &this_event.Rec_IP_wrtPV);
-    this_tree->SetBranchAddress("Rec_NSigmaPion", &this_event.Rec_NSigmaPion);
-    this_tree->SetBranchAddress("Rec_NSigmaProton", &this_event.Rec_NSigmaProton);
-    this_tree->SetBranchAddress("Rec_NClustersTPC", &this_event.Rec_NClustersTPC);
-    this_tree->SetBranchAddress("Rec_isDuplicate", &this_event.Rec_isDuplicate);
-    this_tree->SetBranchAddress("Rec_isSimilar", &this_event.Rec_isSimilar);
-    this_tree->SetBranchAddress("Rec_isSignal", &this_event.Rec_isSignal);
-    this_tree->SetBranchAddress("Rec_HelixParam0", &this_event.Rec_HelixParam0);
-    this_tree->SetBranchAddress("Rec_HelixParam1", &this_event.Rec_HelixParam1);
-    this_tree->SetBranchAddress("Rec_HelixParam2", &this_event.Rec_HelixParam2);
-    this_tree->SetBranchAddress("Rec_HelixParam3", &this_event.Rec_HelixParam3);
-    this_tree->SetBranchAddress("Rec_HelixParam4", &this_event.Rec_HelixParam4);
-    this_tree->SetBranchAddress("Rec_HelixParam5", &this_event.Rec_HelixParam5);
-    /* V0s */
-    this_tree->SetBranchAddress("N_V0s", &this_event.N_V0s);
-    this_tree->SetBranchAddress("Idx_Pos", &this_event.Idx_Pos);
-    this_tree->SetBranchAddress("Idx_Neg", &this_event.Idx_Neg);
-    this_tree->SetBranchAddress("V0_Px", &this_event.V0_Px);
-    this_tree->SetBranchAddress("V0_Py", &this_event.V0_Py);
-    this_tree->SetBranchAddress("V0_Pz", &this_event.V0_Pz);
-    this_tree->SetBranchAddress("V0_X", &this_event.V0_X);
-    this_tree->SetBranchAddress("V0_Y", &this_event.V0_Y);
-    this_tree->SetBranchAddress("V0_Z", &this_event.V0_Z);
-    this_tree->SetBranchAddress("Pos_Px", &this_event.Pos_Px);
-    this_tree->SetBranchAddress("Pos_Py", &this_event.Pos_Py);
-    this_tree->SetBranchAddress("Pos_Pz", &this_event.Pos_Pz);
-    this_tree->SetBranchAddress("Neg_Px", &this_event.Neg_Px);
-    this_tree->SetBranchAddress("Neg_Py", &this_event.Neg_Py);
-    this_tree->SetBranchAddress("Neg_Pz", &this_event.Neg_Pz);
-    this_tree->SetBranchAddress("V0_isSignal", &this_event.V0_isSignal);
-    this_tree->SetBranchAddress("V0_E_asK0", &this_event.V0_E_asK0);
-    this_tree->SetBranchAddress("V0_E_asAL", &this_event.V0_E_asAL);
-    this_tree->SetBranchAddress("V0_couldBeK0", &this_event.V0_couldBeK0);
-    this_tree->SetBranchAddress("V0_couldBeAL", &this_event.V0_couldBeAL);
-    this_tree->SetBranchAddress("V0_Chi2", &this_event.V0_Chi2);
-    this_tree->SetBranchAddress("V0_DCA_Daughters", &this_event.V0_DCA_Daughters);
-    this_tree->SetBranchAddress("V0_IP_wrtPV", &this_event.V0_IP_wrtPV);
-    this_tree->SetBranchAddress("V0_CPA_wrtPV", &this_event.V0_CPA_wrtPV);
-    this_tree->SetBranchAddress("V0_ArmAlpha", &this_event.V0_ArmAlpha);
-    this_tree->SetBranchAddress("V0_ArmPt", &this_event.V0_ArmPt);
-    this_tree->SetBranchAddress("V0_DecayLength", &this_event.V0_DecayLength);
-    this_tree->SetBranchAddress("V0_DCA_wrtPV", &this_event.V0_DCA_wrtPV);
+void ResetEvent(Event_tt& this_event) {
+    //
+    // Forget the vectors allocated by ROOT for the previous tree, which were deleted together with it,
+    // so that LoadBranches() lets ROOT allocate new ones
+    //
+    this_event = Event_tt();
+}
+
+//________________________________________________________________________
+struct Tracks_tt {
+    //
+    // Flat view of the reconstructed tracks of the current entry, one array per variable
+    // (pointers into the branch vectors, valid until the next GetEntry)
+    //
+    Int_t N = 0;                             // number of tracks
+    const Int_t* Idx_True = nullptr;         // index of true MC particle
+    const Float_t* Px = nullptr;             // x-component of reconstructed momentum
+    const Float_t* Py = nullptr;             // y-component of reconstructed momentum
+    const Float_t* Pz = nullptr;             // z-component of reconstructed momentum
+    const Short_t* Charge = nullptr;         // measured charge
+    const Float_t* HelixParam0 = nullptr;    //
+    const Float_t* HelixParam1 = nullptr;    //
+    const Float_t* HelixParam2 = nullptr;    //
+    const Float_t* HelixParam3 = nullptr;    //
+    const Float_t* HelixParam4 = nullptr;    //
+    const Float_t* HelixParam5 = nullptr;    //
+    std::vector<Char_t> isSignal;            // copied, because std::vector<Bool_t> is bit-packed
+};
+
+//________________________________________________________________________
+struct V0s_tt {
+    //
+    // Flat view of the V0s of the current entry, one array per variable
+    // (pointers into the branch vectors, valid until the next GetEntry)
+    //
+    Int_t N = 0;                             // number of V0s
+    const Int_t* Idx_Pos = nullptr;          // index of positive daughter
+    const Int_t* Idx_Neg = nullptr;          // index of negative daughter
+    const Float_t* Px = nullptr;             // x-component of V0 momentum
+    const Float_t* Py = nullptr;             // y-component of V0 momentum
+    const Float_t* Pz = nullptr;             // z-component of V0 momentum
+    const Float_t* X = nullptr;              // x-coordinate of V0
+    const Float_t* Y = nullptr;              // y-coordinate of V0
+    const Float_t* Z = nullptr;              // z-coordinate of V0
+    const Float_t* Pos_Px = nullptr;         // x-component of positive track momentum at V0 position
+    const Float_t* Pos_Py = nullptr;         // y-component of positive track momentum at V0 position
+    const Float_t* Pos_Pz = nullptr;         // z-component of positive track momentum at V0 position
+    const Float_t* Neg_Px = nullptr;         // x-component of negative track momentum at V0 position
+    const Float_t* Neg_Py = nullptr;         // y-component of negative track momentum at V0 position
+    const Float_t* Neg_Pz = nullptr;         // z-component of negative track momentum at V0 position
+    const Float_t* DCA_Daughters = nullptr;  // distance of closest approach between daughters
+    std::vector<Char_t> isSignal;            // copied, because std::vector<Bool_t> is bit-packed
+};
+
+//________________________________________________________________________
+template <typename T>
+const T* GetBranchData(std::vector<T>* branch) {
+    return branch ? branch->data() : nullptr;
+}
+
+//________________________________________________________________________
+void CopyBranchFlags(std::vector<Bool_t>* branch, std::vector<Char_t>& flags) {
+    // assign() keeps the capacity, so the flags are not reallocated once they reach the largest event
+    if (branch) {
+        flags.assign(branch->begin(), branch->end());
+    } else {
+        flags.clear();
+    }
+}
+
+//________________________________________________________________________
+void GetTracks(Event_tt& this_event, Tracks_tt& these_tracks) {
+    //
+    // Point the flat view to the reconstructed tracks of the current entry (needs BRANCHES_REC)
+    //
+    these_tracks.N = this_event.Rec_Px ? this_event.N_MCRec : 0;
+    these_tracks.Idx_True = GetBranchData(this_event.Idx_True);
+    these_tracks.Px = GetBranchData(this_event.Rec_Px);
+    these_tracks.Py = GetBranchData(this_event.Rec_Py);
+    these_tracks.Pz = GetBranchData(this_event.Rec_Pz);
+    these_tracks.Charge = GetBranchData(this_event.Rec_Charge);
+    these_tracks.HelixParam0 = GetBranchData(this_event.Rec_HelixParam0);
+    these_tracks.HelixParam1 = GetBranchData(this_event.Rec_HelixParam1);
+    these_tracks.HelixParam2 = GetBranchData(this_event.Rec_HelixParam2);
+    these_tracks.HelixParam3 = GetBranchData(this_event.Rec_HelixParam3);
+    these_tracks.HelixParam4 = GetBranchData(this_event.Rec_HelixParam4);
+    these_tracks.HelixParam5 = GetBranchData(this_event.Rec_HelixParam5);
+    CopyBranchFlags(this_event.Rec_isSignal, these_tracks.isSignal);
+}
+
+//________________________________________________________________________
+void GetV0s(Event_tt& this_event, V0s_tt& these_v0s) {
+    //
+    // Point the flat view to the V0s of the current entry (needs BRANCHES_V0)
+    //
+    these_v0s.N = this_event.V0_X ? this_event.N_V0s : 0;
+    these_v0s.Idx_Pos = GetBranchData(this_event.Idx_Pos);
+    these_v0s.Idx_Neg = GetBranchData(this_event.Idx_Neg);
+    these_v0s.Px = GetBranchData(this_event.V0_Px);
+    these_v0s.Py = GetBranchData(this_event.V0_Py);
+    these_v0s.Pz = GetBranchData(this_event.V0_Pz);
+    these_v0s.X = GetBranchData(this_event.V0_X);
+    these_v0s.Y = GetBranchData(this_event.V0_Y);
+    these_v0s.Z = GetBranchData(this_event.V0_Z);
+    these_v0s.Pos_Px = GetBranchData(this_event.Pos_Px);
+    these_v0s.Pos_Py = GetBranchData(this_event.Pos_Py);
+    these_v0s.Pos_Pz = GetBranchData(this_event.Pos_Pz);
+    these_v0s.Neg_Px = GetBranchData(this_event.Neg_Px);
+    these_v0s.Neg_Py = GetBranchData(this_event.Neg_Py);
+    these_v0s.Neg_Pz = GetBranchData(this_event.Neg_Pz);
+    these_v0s.DCA_Daughters = GetBranchData(this_event.V0_DCA_Daughters);
+    CopyBranchFlags(this_event.V0_isSignal, these_v0s.isSignal);
+}
+
+//________________________________________________________________________
+struct Sexaquark_tt {
+    //
+    // This is the structure of the Sexaquarks TTree, as read by the display
+    //
+    Int_t RunNumber;       // run number
+    Int_t DirNumber;       // number of the directory within the run
+    Int_t Event;           // event number within the directory
+    Int_t Idx_V0A;         // index of first V0
+    Int_t Idx_V0B;         // index of second V0
+    Float_t Sexa_Px;       // x-component of sexaquark momentum
+    Float_t Sexa_Py;       // y-component of sexaquark momentum
+    Float_t Sexa_Pz;       // z-component of sexaquark momentum
+    Float_t Sexa_X;        // x-coordinate of sexaquark vertex
+    Float_t Sexa_Y;        // y-coordinate of sexaquark vertex
+    Float_t Sexa_Z;        // z-coordinate of sexaquark vertex
+    Bool_t Sexa_isSignal;  // kTRUE if signal, kFALSE if background
+    Float_t V0A_X;         // x-coordinate of first V0
+    Float_t V0A_Y;         // y-coordinate of first V0
+    Float_t V0A_Z;         // z-coordinate of first V0
+    Float_t V0A_Pos_Px;    // x-component of positive track momentum at first V0
+    Float_t V0A_Pos_Py;    // y-component of positive track momentum at first V0
+    Float_t V0A_Pos_Pz;    // z-component of positive track momentum at first V0
+    Float_t V0A_Neg_Px;    // x-component of negative track momentum at first V0
+    Float_t V0A_Neg_Py;    // y-component of negative track momentum at first V0
+    Float_t V0A_Neg_Pz;    // z-component of negative track momentum at first V0
+    Float_t V0B_X;         // x-coordinate of second V0
+    Float_t V0B_Y;         // y-coordinate of second V0
+    Float_t V0B_Z;         // z-coordinate of second V0
+    Float_t V0B_Pos_Px;    // x-component of positive track momentum at second V0
+    Float_t V0B_Pos_Py;    // y-component of positive track momentum at second V0
+    Float_t V0B_Pos_Pz;    // z-component of positive track momentum at second V0
+    Float_t V0B_Neg_Px;    // x-component of negative track momentum at second V0
+    Float_t V0B_Neg_Py;    // y-component of negative track momentum at second V0
+    Float_t V0B_Neg_Pz;    // z-component of negative track momentum at second V0
+};
+
+//________________________________________________________________________
+void LoadSexaquarkBranches(TTree* this_tree, Sexaquark_tt& this_sexa) {
+    // read only the branches that are drawn
+    this_tree->SetBranchStatus("*", 0);
+    for (TString branch_name : {"RunNumber", "DirNumber", "Event", "Idx_V0A", "Idx_V0B", "Px", "Py", "Pz", "X", "Y", "Z", "isSignal",  //
+                                "V0A_X", "V0A_Y", "V0A_Z", "V0A_Pos_Px", "V0A_Pos_Py", "V0A_Pos_Pz", "V0A_Neg_Px", "V0A_Neg_Py",    //
+                                "V0A_Neg_Pz", "V0B_X", "V0B_Y", "V0B_Z", "V0B_Pos_Px", "V0B_Pos_Py", "V0B_Pos_Pz", "V0B_Neg_Px",    //
+                                "V0B_Neg_Py", "V0B_Neg_Pz"}) {
+        this_tree->SetBranchStatus(branch_name, 1);
+    }
+
+    this_tree->SetBranchAddress("RunNumber", &this_sexa.RunNumber);
+    this_tree->SetBranchAddress("DirNumber", &this_sexa.DirNumber);
+    this_tree->SetBranchAddress("Event", &this_sexa.Event);
+
+    this_tree->SetBranchAddress("Idx_V0A", &this_sexa.Idx_V0A);
+    this_tree->SetBranchAddress("Idx_V0B", &this_sexa.Idx_V0B);
+    this_tree->SetBranchAddress("Px", &this_sexa.Sexa_Px);
+    this_tree->SetBranchAddress("Py", &this_sexa.Sexa_Py);
+    this_tree->SetBranchAddress("Pz", &this_sexa.Sexa_Pz);
+    this_tree->SetBranchAddress("X", &this_sexa.Sexa_X);
+    this_tree->SetBranchAddress("Y", &this_sexa.Sexa_Y);
+    this_tree->SetBranchAddress("Z", &this_sexa.Sexa_Z);
+    this_tree->SetBranchAddress("isSignal", &this_sexa.Sexa_isSignal);
+
+    this_tree->SetBranchAddress("V0A_X", &this_sexa.V0A_X);
+    this_tree->SetBranchAddress("V0A_Y", &this_sexa.V0A_Y);
+    this_tree->SetBranchAddress("V0A_Z", &this_sexa.V0A_Z);
+    this_tree->SetBranchAddress("V0A_Pos_Px", &this_sexa.V0A_Pos_Px);
+    this_tree->SetBranchAddress("V0A_Pos_Py", &this_sexa.V0A_Pos_Py);
+    this_tree->SetBranchAddress("V0A_Pos_Pz", &this_sexa.V0A_Pos_Pz);
+    this_tree->SetBranchAddress("V0A_Neg_Px", &this_sexa.V0A_Neg_Px);
+    this_tree->SetBranchAddress("V0A_Neg_Py", &this_sexa.V0A_Neg_Py);
+    this_tree->SetBranchAddress("V0A_Neg_Pz", &this_sexa.V0A_Neg_Pz);
+
+    this_tree->SetBranchAddress("V0B_X", &this_sexa.V0B_X);
+    this_tree->SetBranchAddress("V0B_Y", &this_sexa.V0B_Y);
+    this_tree->SetBranchAddress("V0B_Z", &this_sexa.V0B_Z);
+    this_tree->SetBranchAddress("V0B_Pos_Px", &this_sexa.V0B_Pos_Px);
+    this_tree->SetBranchAddress("V0B_Pos_Py", &this_sexa.V0B_Pos_Py);
+    this_tree->SetBranchAddress("V0B_Pos_Pz", &this_sexa.V0B_Pos_Pz);
+    this_tree->SetBranchAddress("V0B_Neg_Px", &this_sexa.V0B_Neg_Px);
+    this_tree->SetBranchAddress("V0B_Neg_Py", &this_sexa.V0B_Neg_Py);
+    this_tree->SetBranchAddress("V0B_Neg_Pz", &this_sexa.V0B_Neg_Pz);
 }
 
 #endif
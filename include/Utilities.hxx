@@ -38,73 +38,180 @@ void ParseTreeFilename(TString name, TString &dirname, TString &filename, TStrin
     */
 }
 
+// read-ahead buffer of the event trees
+#define EVENT_CACHE_SIZE 10000000  // 10 MB
+
 //_____________________________________________________________________________
-void AddFileToList(TList *list, const char *name) {
+struct EventFiles_tt {
     //
-    // Add a new file to this list
+    // Set of files that match a name, read as a single sequence of events
+    // Only the file that holds the current event is kept open
     //
-
-    TString dirname, basename, listname, treename;
-    ParseTreeFilename(name, dirname, basename, listname, treename);
-
-    TFile *input_file = new TFile(dirname + "/" + basename, "READ");
-    TList *input_list = (TList *)input_file->Get(listname);
-    TTree *input_tree = (TTree *)input_list->FindObject(treename);
-
-    list->Add(input_tree);
-}
+    TString ListName;                // name of the TList that holds the tree
+    TString TreeName;                // name of the tree
+    std::vector<TString> Filenames;  // matching files, sorted in alphanumeric order
+    std::vector<Long64_t> Offsets;   // number of events before each file, and the total number of events at the end
+    Int_t Current = -1;              // index of the open file
+    TFile *File = nullptr;           // open file
+    TTree *Tree = nullptr;           // tree of the open file
+    Event_tt *Event = nullptr;       // branch buffers of the tree, reset when the file is closed
+};
 
 //_____________________________________________________________________________
-void AddTreesToList(TList *list, const char *name) {
-    //
+void ExpandFilenames(const char *name, std::vector<TString> &filenames, TString &listname, TString &treename) {
     //
+    // Get the files that match name, which can contain wildcards in the file part
+    // e.g. "./AnalysisResults_CustomV0s_*.root/Trees/Events"
     //
 
-    TString directory, basename, listname, treename;
+    TString directory, basename;
     ParseTreeFilename(name, directory, basename, listname, treename);
 
+    filenames.clear();
+
     // case with one single file
     if (!basename.MaybeWildcard()) {
-        return AddFileToList(list, name);
-    }  // closure
-
-    // wildcarding used in name
-    // printf("AddTreesToList :: directory = %s\n", directory.Data());
+        filenames.push_back(directory + "/" + basename);
+        return;
+    }
 
     const char *epath = gSystem->ExpandPathName(directory.Data());
     void *dir = gSystem->OpenDirectory(epath);
     delete[] epath;
 
-    const char *file;
-
-    if (dir) {
-        // create a TList to store the filenames (not yet sorted)
-        TList l;
-        TRegexp re(basename, kTRUE);
-        while ((file = gSystem->GetDirEntry(dir))) {
-            if (!strcmp(file, ".") || !strcmp(file, "..")) {
-                continue;
-            }
-            TString s = file;
-            if ((basename != file) && s.Index(re) == kNPOS) {
-                continue;
-            }
-            // printf("AddTreesToList :: file = %s\n", file);
-            l.Add(new TObjString(file));
+    if (!dir) return;
+
+    TRegexp re(basename, kTRUE);
+    while (const char *file = gSystem->GetDirEntry(dir)) {
+        if (!strcmp(file, ".") || !strcmp(file, "..")) {
+            continue;
         }
-        gSystem->FreeDirectory(dir);
+        TString s = file;
+        if ((basename != file) && s.Index(re) == kNPOS) {
+            continue;
+        }
+        filenames.push_back(directory + "/" + file);
+    }
+    gSystem->FreeDirectory(dir);
+
+    // sort the files in alphanumeric order
+    std::sort(filenames.begin(), filenames.end());
+}
 
-        // sort the files in alphanumeric order
-        l.Sort();
+//_____________________________________________________________________________
+TTree *GetTreeFromList(TFile *input_file, TString listname, TString treename) {
+    //
+    // Take the tree out of its TList and attach it to the file, so that deleting the file deletes it
+    //
+    TList *input_list = (TList *)input_file->Get(listname);
+    if (!input_list) return nullptr;
 
-        TIter next(&l);
-        TObjString *obj;
-        while ((obj = (TObjString *)next())) {
-            file = obj->GetName();
-            AddFileToList(list, TString::Format("%s/%s/%s/%s", directory.Data(), file, listname.Data(), treename.Data()));
-        }
-        l.Delete();
+    TTree *input_tree = (TTree *)input_list->FindObject(treename);
+    if (input_tree) {
+        input_list->Remove(input_tree);
+        input_tree->SetDirectory(input_file);
     }
+
+    input_list->SetOwner(kTRUE);
+    delete input_list;
+
+    return input_tree;
+}
+
+//_____________________________________________________________________________
+Long64_t CountEntries(TString filename, TString listname, TString treename) {
+    //
+    // Number of entries of the tree in this file, which is closed afterwards
+    //
+    TFile input_file(filename, "READ");
+    if (input_file.IsZombie()) return 0;
+
+    TTree *input_tree = GetTreeFromList(&input_file, listname, treename);
+    return input_tree ? input_tree->GetEntries() : 0;
+}
+
+//_____________________________________________________________________________
+void OpenEventFiles(EventFiles_tt &event_files, const char *name, Event_tt &this_event) {
+    //
+    // Find the files that match name, and count their events
+    // The files are opened concurrently when there are several, and closed right after reading their number of entries
+    // - this_event: buffers that will be given to LoadBranches() for the trees of these files
+    //
+    ScopedTimer timer("File scan");
+
+    ExpandFilenames(name, event_files.Filenames, event_files.ListName, event_files.TreeName);
+    event_files.Event = &this_event;
+
+    std::vector<Long64_t> n_entries;
+    auto count_entries = [&event_files](TString filename) {
+        return CountEntries(filename, event_files.ListName, event_files.TreeName);
+    };
+
+#ifdef R__USE_IMT
+    // several files are counted concurrently, which switches ROOT into thread-safe mode for the rest of the process
+    if (event_files.Filenames.size() > 1) {
+        ROOT::EnableThreadSafety();
+        ROOT::TThreadExecutor executor;
+        n_entries = executor.Map(count_entries, event_files.Filenames);
+    }
+#endif
+    if (n_entries.empty()) {
+        for (TString filename : event_files.Filenames) n_entries.push_back(count_entries(filename));
+    }
+
+    event_files.Offsets.assign(1, 0);
+    for (Long64_t n : n_entries) event_files.Offsets.push_back(event_files.Offsets.back() + n);
+
+    // read ahead baskets in the background, when the files are remote
+    gEnv->SetValue("TFile.AsyncPrefetching", 1);
+
+    // (debug)
+    LOG_INFO("OpenEventFiles :: Found %lld events in %zu files\n", event_files.Offsets.back(), event_files.Filenames.size());
+}
+
+//_____________________________________________________________________________
+void CloseEventFiles(EventFiles_tt &event_files) {
+    if (event_files.File) {
+        delete event_files.File;  // deletes the tree too, and the vectors that ROOT allocated for its branches
+        if (event_files.Event) ResetEvent(*event_files.Event);
+    }
+    event_files.File = nullptr;
+    event_files.Tree = nullptr;
+    event_files.Current = -1;
+}
+
+//_____________________________________________________________________________
+TTree *GetEventTree(EventFiles_tt &event_files, Long64_t event, Long64_t &entry) {
+    //
+    // Open the file that holds this event, if it's not open already, and return its tree
+    // - event: index over all the files
+    // - entry: output, index of the event within the returned tree
+    //
+    if (event < 0 || event >= event_files.Offsets.back()) {
+        printf("GetEventTree :: ERROR: event %lld out of range, there are %lld events\n", event, event_files.Offsets.back());
+        return nullptr;
+    }
+
+    Int_t file_index = std::upper_bound(event_files.Offsets.begin(), event_files.Offsets.end(), event) - event_files.Offsets.begin() - 1;
+    entry = event - event_files.Offsets[file_index];
+
+    if (file_index == event_files.Current) return event_files.Tree;
+
+    ScopedTimer timer("Tree open");
+
+    CloseEventFiles(event_files);
+
+    event_files.File = new TFile(event_files.Filenames[file_index], "READ");
+    event_files.Tree = GetTreeFromList(event_files.File, event_files.ListName, event_files.TreeName);
+    event_files.Current = file_index;
+    if (!event_files.Tree) return nullptr;
+
+    event_files.Tree->SetCacheSize(EVENT_CACHE_SIZE);
+
+    // (debug)
+    LOG_INFO("GetEventTree :: Event %lld is entry %lld of %s\n", event, entry, event_files.Filenames[file_index].Data());
+
+    return event_files.Tree;
 }
 
 #endif
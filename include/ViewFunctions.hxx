@@ -0,0 +1,821 @@
+#ifndef VIEW_FUNCTIONS_HXX
+#define VIEW_FUNCTIONS_HXX
+
+//_____________________________________________________________________________
+void InitDisplay(Bool_t map_window = kTRUE) {
+    //
+    // Create the Eve manager and add the global elements: TPC and beam axis
+    // - map_window: when kFALSE, the viewer is created but not shown (batch mode)
+    //
+
+    gSystem->Load("libGeom");
+
+    {
+        ScopedTimer timer("TEve creation");
+        TEveManager::Create(map_window);
+    }
+
+    // only the TPC shell is displayed, its shape is read from the geometry cache
+    ScopedTimer timer("Geometry load");
+    TEveGeoShapeExtract *geometry_extract = LoadGeometryCache();
+    if (geometry_extract) {
+        TEveGeoShape *tpc = TEveGeoShape::ImportShapeExtract(geometry_extract, nullptr);
+        gEve->AddGlobalElement(tpc);
+    }
+
+    // beam axis
+    TEveLine *beam_axis = new TEveLine();
+    beam_axis->SetNextPoint(0.0, 0.0, -650.0);
+    beam_axis->SetNextPoint(0.0, 0.0, 650.0);
+    beam_axis->SetName("beam axis");
+    beam_axis->SetLineStyle(1);
+    beam_axis->SetLineWidth(2);
+    beam_axis->SetMainAlpha(0.7);
+    beam_axis->SetMainColor(kWhite);
+    gEve->AddGlobalElement(beam_axis);
+}
+
+//_____________________________________________________________________________
+void DrawSexaquarkCandidate(Sexaquark_tt &this_sexa, Long64_t candidate, TEveElement *parent) {
+    //
+    // Draw a sexaquark candidate -- the sexaquark, both V0s and their daughters -- into parent
+    //
+
+    Short_t aux_charge;
+    Double_t aux_p[3];
+    Double_t aux_x[3];
+    Double_t aux_helix_params[8];
+
+    /* Sexaquark */
+
+    TEveLine *line_sexa = new TEveLine();
+    line_sexa->SetNextPoint(0., 0., 0.);  // PENDING!
+    line_sexa->SetNextPoint(this_sexa.Sexa_X, this_sexa.Sexa_Y, this_sexa.Sexa_Z);
+    line_sexa->SetLineStyle(9);
+    line_sexa->SetLineWidth(LINE_WIDTH);
+    line_sexa->SetMainColor(kPink);
+    line_sexa->SetName(Form("Sexa%lld", candidate));
+
+    parent->AddElement(line_sexa);
+
+    /* V0A */
+
+    TEveLine *line_v0a = new TEveLine();
+    line_v0a->SetNextPoint(this_sexa.Sexa_X, this_sexa.Sexa_Y, this_sexa.Sexa_Z);
+    line_v0a->SetNextPoint(this_sexa.V0A_X, this_sexa.V0A_Y, this_sexa.V0A_Z);
+    line_v0a->SetLineStyle(1);
+    line_v0a->SetLineWidth(LINE_WIDTH);
+    line_v0a->SetMainColor(kGreen);
+    line_v0a->SetName(Form("Sexa%lld_V0A%i", candidate, this_sexa.Idx_V0A));
+
+    parent->AddElement(line_v0a);
+
+    /* V0A - Negative Daughter */
+
+    TEveLine *line_v0a_neg_dau = new TEveLine();
+
+    // get helix params
+    aux_charge = -1;
+    aux_x[0] = this_sexa.V0A_X;
+    aux_x[1] = this_sexa.V0A_Y;
+    aux_x[2] = this_sexa.V0A_Z;
+    LOG_DEBUG("SexaquarkDisplay :: V0A :: Negative Daughter :: Origin = (%.3f, %.3f, %.3f)\n", aux_x[0], aux_x[1], aux_x[2]);
+    aux_p[0] = this_sexa.V0A_Neg_Px;
+    aux_p[1] = this_sexa.V0A_Neg_Py;
+    aux_p[2] = this_sexa.V0A_Neg_Pz;
+    LOG_DEBUG("SexaquarkDisplay :: V0A :: Negative Daughter :: Momentum = (%.3f, %.3f, %.3f)\n", aux_p[0], aux_p[1], aux_p[2]);
+
+    GetHelixParamsFromKine(aux_x, aux_p, aux_charge, aux_helix_params);
+    LOG_DEBUG("SexaquarkDisplay :: V0A :: Negative Daughter :: Params = {%.3f, %.3f, %.3f, %.3f, %.3f, %.3f}\n",  //
+           aux_helix_params[0], aux_helix_params[1],                                                           //
+           aux_helix_params[2], aux_helix_params[3],                                                           //
+           aux_helix_params[4], aux_helix_params[5]);
+
+    // (2) draw track
+    {
+        ScopedTimer timer("Helix sampling");
+        SampleHelix(line_v0a_neg_dau, aux_helix_params, 0., 750.);
+    }
+
+    line_v0a_neg_dau->SetLineStyle(1);
+    line_v0a_neg_dau->SetLineWidth(LINE_WIDTH);
+    line_v0a_neg_dau->SetName(Form("Sexa%lld_V0A%i_Neg", candidate, this_sexa.Idx_V0A));
+    line_v0a_neg_dau->SetMainColor(kMagenta);
+
+    parent->AddElement(line_v0a_neg_dau);
+
+    /* V0A - Positive Daughter */
+
+    TEveLine *line_v0a_pos_dau = new TEveLine();
+
+    // get helix params
+    aux_charge = +1;
+    aux_x[0] = this_sexa.V0A_X;
+    aux_x[1] = this_sexa.V0A_Y;
+    aux_x[2] = this_sexa.V0A_Z;
+    LOG_DEBUG("SexaquarkDisplay :: V0A :: Positive Daughter :: Origin = (%.3f, %.3f, %.3f)\n", aux_x[0], aux_x[1], aux_x[2]);
+    aux_p[0] = this_sexa.V0A_Pos_Px;
+    aux_p[1] = this_sexa.V0A_Pos_Py;
+    aux_p[2] = this_sexa.V0A_Pos_Pz;
+    LOG_DEBUG("SexaquarkDisplay :: V0A :: Positive Daughter :: Momentum = (%.3f, %.3f, %.3f)\n", aux_p[0], aux_p[1], aux_p[2]);
+
+    GetHelixParamsFromKine(aux_x, aux_p, aux_charge, aux_helix_params);
+    LOG_DEBUG("SexaquarkDisplay :: V0A :: Positive Daughter :: Params = {%.3f, %.3f, %.3f, %.3f, %.3f, %.3f}\n",  //
+           aux_helix_params[0], aux_helix_params[1],                                                           //
+           aux_helix_params[2], aux_helix_params[3],                                                           //
+           aux_helix_params[4], aux_helix_params[5]);
+
+    // (2) draw track
+    {
+        ScopedTimer timer("Helix sampling");
+        SampleHelix(line_v0a_pos_dau, aux_helix_params, 0., 750.);
+    }
+
+    line_v0a_pos_dau->SetLineStyle(1);
+    line_v0a_pos_dau->SetLineWidth(LINE_WIDTH);
+    line_v0a_pos_dau->SetName(Form("Sexa%lld_V0A%i_Pos", candidate, this_sexa.Idx_V0A));
+    line_v0a_pos_dau->SetMainColor(kCyan);
+
+    parent->AddElement(line_v0a_pos_dau);
+
+    /* V0B */
+
+    TEveLine *line_v0b = new TEveLine();
+    line_v0b->SetNextPoint(this_sexa.Sexa_X, this_sexa.Sexa_Y, this_sexa.Sexa_Z);
+    line_v0b->SetNextPoint(this_sexa.V0B_X, this_sexa.V0B_Y, this_sexa.V0B_Z);
+    line_v0b->SetLineStyle(1);
+    line_v0b->SetLineWidth(LINE_WIDTH);
+    line_v0b->SetMainColor(kGreen);
+    line_v0b->SetName(Form("Sexa%lld_V0B%i", candidate, this_sexa.Idx_V0B));
+
+    parent->AddElement(line_v0b);
+
+    /* V0B - Negative Daughter */
+
+    TEveLine *line_v0b_neg_dau = new TEveLine();
+
+    // get helix params
+    aux_charge = -1;
+    aux_x[0] = this_sexa.V0B_X;
+    aux_x[1] = this_sexa.V0B_Y;
+    aux_x[2] = this_sexa.V0B_Z;
+    LOG_DEBUG("SexaquarkDisplay :: V0B :: Negative Daughter :: Origin = (%.3f, %.3f, %.3f)\n", aux_x[0], aux_x[1], aux_x[2]);
+    aux_p[0] = this_sexa.V0B_Neg_Px;
+    aux_p[1] = this_sexa.V0B_Neg_Py;
+    aux_p[2] = this_sexa.V0B_Neg_Pz;
+    LOG_DEBUG("SexaquarkDisplay :: V0B :: Negative Daughter :: Momentum = (%.3f, %.3f, %.3f)\n", aux_p[0], aux_p[1], aux_p[2]);
+
+    GetHelixParamsFromKine(aux_x, aux_p, aux_charge, aux_helix_params);
+    LOG_DEBUG("SexaquarkDisplay :: V0B :: Negative Daughter :: Params = {%.3f, %.3f, %.3f, %.3f, %.3f, %.3f}\n",  //
+           aux_helix_params[0], aux_helix_params[1],                                                           //
+           aux_helix_params[2], aux_helix_params[3],                                                           //
+           aux_helix_params[4], aux_helix_params[5]);
+
+    // (2) draw track
+    {
+        ScopedTimer timer("Helix sampling");
+        SampleHelix(line_v0b_neg_dau, aux_helix_params, 0., 750.);
+    }
+
+    line_v0b_neg_dau->SetLineStyle(1);
+    line_v0b_neg_dau->SetLineWidth(LINE_WIDTH);
+    line_v0b_neg_dau->SetName(Form("Sexa%lld_V0B%i_Neg", candidate, this_sexa.Idx_V0B));
+    line_v0b_neg_dau->SetMainColor(kMagenta);
+
+    parent->AddElement(line_v0b_neg_dau);
+
+    /* V0B - Positive Daughter */
+
+    TEveLine *line_v0b_pos_dau = new TEveLine();
+
+    // get helix params
+    aux_charge = +1;
+    aux_x[0] = this_sexa.V0B_X;
+    aux_x[1] = this_sexa.V0B_Y;
+    aux_x[2] = this_sexa.V0B_Z;
+    LOG_DEBUG("SexaquarkDisplay :: V0B :: Positive Daughter :: Origin = (%.3f, %.3f, %.3f)\n", aux_x[0], aux_x[1], aux_x[2]);
+    aux_p[0] = this_sexa.V0B_Pos_Px;
+    aux_p[1] = this_sexa.V0B_Pos_Py;
+    aux_p[2] = this_sexa.V0B_Pos_Pz;
+    LOG_DEBUG("SexaquarkDisplay :: V0B :: Positive Daughter :: Momentum = (%.3f, %.3f, %.3f)\n", aux_p[0], aux_p[1], aux_p[2]);
+
+    GetHelixParamsFromKine(aux_x, aux_p, aux_charge, aux_helix_params);
+    LOG_DEBUG("SexaquarkDisplay :: V0B :: Positive Daughter :: Params = {%.3f, %.3f, %.3f, %.3f, %.3f, %.3f}\n",  //
+           aux_helix_params[0], aux_helix_params[1],                                                           //
+           aux_helix_params[2], aux_helix_params[3],                                                           //
+           aux_helix_params[4], aux_helix_params[5]);
+
+    // (2) draw track
+    {
+        ScopedTimer timer("Helix sampling");
+        SampleHelix(line_v0b_pos_dau, aux_helix_params, 0., 750.);
+    }
+
+    line_v0b_pos_dau->SetLineStyle(1);
+    line_v0b_pos_dau->SetLineWidth(LINE_WIDTH);
+    line_v0b_pos_dau->SetName(Form("Sexa%lld_V0B%i_Pos", candidate, this_sexa.Idx_V0B));
+    line_v0b_pos_dau->SetMainColor(kCyan);
+
+    parent->AddElement(line_v0b_pos_dau);
+
+    /* Sexaquark Vertex */
+
+    // (debug) both V0s are neutral, their lines of flight should meet at the sexaquark vertex
+    Double_t aux_v0a_x[3] = {this_sexa.V0A_X, this_sexa.V0A_Y, this_sexa.V0A_Z};
+    Double_t aux_v0a_p[3] = {this_sexa.V0A_Pos_Px + this_sexa.V0A_Neg_Px,  //
+                             this_sexa.V0A_Pos_Py + this_sexa.V0A_Neg_Py,  //
+                             this_sexa.V0A_Pos_Pz + this_sexa.V0A_Neg_Pz};
+    Double_t aux_v0b_x[3] = {this_sexa.V0B_X, this_sexa.V0B_Y, this_sexa.V0B_Z};
+    Double_t aux_v0b_p[3] = {this_sexa.V0B_Pos_Px + this_sexa.V0B_Neg_Px,  //
+                             this_sexa.V0B_Pos_Py + this_sexa.V0B_Neg_Py,  //
+                             this_sexa.V0B_Pos_Pz + this_sexa.V0B_Neg_Pz};
+    Double_t aux_sexa_vertex[3];
+    Double_t aux_dca_v0s = GetDCALineToLine(aux_v0a_x, aux_v0a_p, aux_v0b_x, aux_v0b_p, aux_sexa_vertex);
+    LOG_DEBUG("SexaquarkDisplay :: Sexaquark :: DCA between V0s = %.3f\n", aux_dca_v0s);
+    LOG_DEBUG("SexaquarkDisplay :: Sexaquark :: Vertex = (%.3f, %.3f, %.3f) (stored: (%.3f, %.3f, %.3f))\n",  //
+           aux_sexa_vertex[0], aux_sexa_vertex[1], aux_sexa_vertex[2], this_sexa.Sexa_X, this_sexa.Sexa_Y, this_sexa.Sexa_Z);
+}
+
+//_____________________________________________________________________________
+void DrawMCEvent(Event_tt &this_event, TEveElement *parent) {
+    //
+    // Draw the MC signal V0s of this event and their daughters into parent
+    //
+
+    Int_t aux_pid;
+    Short_t aux_charge;
+    Double_t aux_p[3];
+    Double_t aux_x[3];
+    Double_t aux_helix_params[8];
+
+    // (debug)
+    LOG_DEBUG("EventDisplay :: MC Particles :: Number of MC Particles = %i\n", this_event.N_MCGen);
+
+    // (loop) over MC particles
+    for (Int_t evt_mc = 0; evt_mc < this_event.N_MCGen; evt_mc++) {
+
+        // it must be a neutral kaon short or an anti-lambda
+        if ((*this_event.MC_PID)[evt_mc] != 310 && (*this_event.MC_PID)[evt_mc] != -3122) {
+            continue;
+        }
+
+        if ((*this_event.MC_isSignal)[evt_mc]) {
+            TEveLine *this_sexa = new TEveLine();
+            this_sexa->SetNextPoint(0., 0., 0.);
+            this_sexa->SetNextPoint((*this_event.MC_X)[evt_mc], (*this_event.MC_Y)[evt_mc], (*this_event.MC_Z)[evt_mc]);
+            this_sexa->SetLineStyle(9);
+            this_sexa->SetLineWidth(LINE_WIDTH);
+            this_sexa->SetName("mc_sexa");
+            this_sexa->SetMainColor(kPink);
+            parent->AddElement(this_sexa);
+        } else {
+            continue;  // TEMPORARY MEASURE!!
+        }
+
+        /* MC V0 */
+
+        // label signal one
+        TString this_v0_id = "K0";
+        if ((*this_event.MC_PID)[evt_mc] == -3122) this_v0_id = "AL";
+        TString this_v0_name = Form("mc_%i_%s", evt_mc, this_v0_id.Data());
+        Color_t this_v0_color = (*this_event.MC_isSignal)[evt_mc] ? kGreen : kYellow;
+        // Color_t this_v0_color = myOrange;
+
+        TEveLine *this_v0 = new TEveLine();
+        this_v0->SetNextPoint((*this_event.MC_X)[evt_mc], (*this_event.MC_Y)[evt_mc], (*this_event.MC_Z)[evt_mc]);
+        this_v0->SetNextPoint((*this_event.MC_Xf)[evt_mc], (*this_event.MC_Yf)[evt_mc], (*this_event.MC_Zf)[evt_mc]);
+        this_v0->SetLineStyle(1);
+        this_v0->SetLineWidth(LINE_WIDTH);
+        this_v0->SetName(this_v0_name);
+        this_v0->SetMainColor(this_v0_color);
+
+        parent->AddElement(this_v0);
+
+        // plot daughters, only if they're signal
+        if (!(*this_event.MC_isSignal)[evt_mc]) {
+            continue;
+        }
+
+        if ((*this_event.MC_NDaughters)[evt_mc] != 2) {
+            continue;
+        }
+
+        if ((*this_event.MC_NDaughters)[evt_mc] < 0) {
+            continue;
+        }
+
+        // (debug)
+        LOG_DEBUG("EventDisplay :: MC Particles :: V0 :: Index = %i\n", evt_mc);
+        LOG_DEBUG("EventDisplay :: MC Particles :: V0 :: PID = %i\n", (*this_event.MC_PID)[evt_mc]);
+
+        /* First Daughter */
+
+        // (debug)
+        LOG_DEBUG("EventDisplay :: MC Particles :: First Daughter :: Index = %i\n", (*this_event.MC_FirstDau)[evt_mc]);
+
+        // get helix params
+        aux_pid = (*this_event.MC_PID)[(*this_event.MC_FirstDau)[evt_mc]];
+
+        if (TMath::Abs(aux_pid) == 211 || aux_pid == -2212) {
+
+            LOG_DEBUG("EventDisplay :: MC Particles :: First Daughter :: PID = %i\n", aux_pid);
+            aux_charge = aux_pid == 211 ? 1 : -1;
+
+            aux_x[0] = (*this_event.MC_X)[(*this_event.MC_FirstDau)[evt_mc]];
+            aux_x[1] = (*this_event.MC_Y)[(*this_event.MC_FirstDau)[evt_mc]];
+            aux_x[2] = (*this_event.MC_Z)[(*this_event.MC_FirstDau)[evt_mc]];
+            LOG_DEBUG("EventDisplay :: MC Particles :: First Daughter :: Origin = (%.3f, %.3f, %.3f)\n", aux_x[0], aux_x[1], aux_x[2]);
+
+            aux_p[0] = (*this_event.MC_Px)[(*this_event.MC_FirstDau)[evt_mc]];
+            aux_p[1] = (*this_event.MC_Py)[(*this_event.MC_FirstDau)[evt_mc]];
+            aux_p[2] = (*this_event.MC_Pz)[(*this_event.MC_FirstDau)[evt_mc]];
+            LOG_DEBUG("EventDisplay :: MC Particles :: First Daughter :: Momentum = (%.3f, %.3f, %.3f)\n", aux_p[0], aux_p[1], aux_p[2]);
+
+            GetHelixParamsFromKine(aux_x, aux_p, aux_charge, aux_helix_params);
+
+            TEveLine *this_first_dau = new TEveLine();
+
+            // draw helix lines, from the origin of the daughter, i.e. the decay vertex of the V0
+            {
+                ScopedTimer timer("Helix sampling");
+                SampleHelix(this_first_dau, aux_helix_params, 0., 450.);
+            }
+
+            this_first_dau->SetLineStyle(1);
+            this_first_dau->SetLineWidth(LINE_WIDTH);
+            this_first_dau->SetName(Form("%i", aux_pid));
+            this_first_dau->SetMainColor(aux_charge > 0 ? kCyan : kMagenta);
+
+            parent->AddElement(this_first_dau);
+
+        }  // end of pid condition for first daughter
+
+        /* Last Daughter */
+
+        // (debug)
+        LOG_DEBUG("EventDisplay :: MC Particles :: Last Daughter :: Index = %i\n", (*this_event.MC_LastDau)[evt_mc]);
+
+        // get helix params
+        aux_pid = (*this_event.MC_PID)[(*this_event.MC_LastDau)[evt_mc]];
+
+        // is the particle a pion or an anti-proton?
+        if (TMath::Abs(aux_pid) == 211 || aux_pid == -2212) {
+
+            LOG_DEBUG("EventDisplay :: MC Particles :: Last Daughter :: PID = %i\n", aux_pid);
+            aux_charge = aux_pid == 211 ? 1 : -1;
+
+            aux_x[0] = (*this_event.MC_X)[(*this_event.MC_LastDau)[evt_mc]];
+            aux_x[1] = (*this_event.MC_Y)[(*this_event.MC_LastDau)[evt_mc]];
+            aux_x[2] = (*this_event.MC_Z)[(*this_event.MC_LastDau)[evt_mc]];
+            LOG_DEBUG("EventDisplay :: MC Particles :: Last Daughter :: Origin = (%.3f, %.3f, %.3f)\n", aux_x[0], aux_x[1], aux_x[2]);
+
+            aux_p[0] = (*this_event.MC_Px)[(*this_event.MC_LastDau)[evt_mc]];
+            aux_p[1] = (*this_event.MC_Py)[(*this_event.MC_LastDau)[evt_mc]];
+            aux_p[2] = (*this_event.MC_Pz)[(*this_event.MC_LastDau)[evt_mc]];
+            LOG_DEBUG("EventDisplay :: MC Particles :: Last Daughter :: Momentum = (%.3f, %.3f, %.3f)\n", aux_p[0], aux_p[1], aux_p[2]);
+
+            GetHelixParamsFromKine(aux_x, aux_p, aux_charge, aux_helix_params);
+
+            TEveLine *this_last_dau = new TEveLine();
+
+            // draw helix lines, from the origin of the daughter, i.e. the decay vertex of the V0
+            {
+                ScopedTimer timer("Helix sampling");
+                SampleHelix(this_last_dau, aux_helix_params, 0., 450.);
+            }
+
+            this_last_dau->SetLineStyle(1);
+            this_last_dau->SetLineWidth(LINE_WIDTH);
+            this_last_dau->SetName(Form("%i", aux_pid));  // PENDING
+            this_last_dau->SetMainColor(aux_charge > 0 ? kCyan : kMagenta);
+
+            parent->AddElement(this_last_dau);
+        }  // end of pid condition for last daughter
+
+    }  // end of loop over MC gen. particles
+}
+
+//_____________________________________________________________________________
+void GetTrackHelixParams(Event_tt &this_event, Tracks_tt &these_tracks, Int_t trk, Double_t params[8]) {
+    //
+    // Helix of a reconstructed track: its momentum, placed at the generation vertex of its true MC particle,
+    // or at the origin when there is none
+    //
+    Int_t aux_mc = these_tracks.Idx_True[trk];
+    Bool_t has_origin = aux_mc >= 0 && this_event.MC_X && aux_mc < (Int_t)this_event.MC_X->size();
+    Double_t aux_x[3] = {has_origin ? (*this_event.MC_X)[aux_mc] : 0.,  //
+                         has_origin ? (*this_event.MC_Y)[aux_mc] : 0.,  //
+                         has_origin ? (*this_event.MC_Z)[aux_mc] : 0.};
+    Double_t aux_p[3] = {these_tracks.Px[trk], these_tracks.Py[trk], these_tracks.Pz[trk]};
+    GetHelixParamsFromKine(aux_x, aux_p, these_tracks.Charge[trk], params);
+}
+
+//_____________________________________________________________________________
+void DrawFoundV0s(Event_tt &this_event, Tracks_tt &these_tracks, V0s_tt &these_v0s, Int_t input_v0a, Int_t input_v0b,  //
+                  TEveElement *parent) {
+    //
+    // Draw two found V0s of this event and their daughters into parent
+    // (needs BRANCHES_MC, BRANCHES_REC and BRANCHES_V0, see GetTrackHelixParams())
+    //
+
+    Double_t aux_neg_helix_params[8];
+    Double_t aux_pos_helix_params[8];
+    Double_t aux_v0_vertex[3];
+    Double_t aux_min_dist_to_v0;
+    Double_t aux_min_track_path;
+    Double_t aux_neg_dca_path;
+    Double_t aux_pos_dca_path;
+
+    // (debug)
+    LOG_DEBUG("EventDisplay :: Found V0s :: Number of Found V0s = %i\n", these_v0s.N);
+
+    // for (Int_t evt_v0 = 0; evt_v0 < these_v0s.N; evt_v0++) {
+    // for (Int_t evt_v0 = 0; evt_v0 < 2; evt_v0++) {
+    for (Int_t evt_v0 : {input_v0a, input_v0b}) {
+
+        if (evt_v0 < 0 || evt_v0 >= these_v0s.N) {
+            printf("DrawFoundV0s :: ERROR: V0 %i out of range, there are %i V0s\n", evt_v0, these_v0s.N);
+            continue;
+        }
+
+        // (debug)
+        LOG_DEBUG("-> v0 %i\n", evt_v0);
+
+        /* Rec. V0 */
+
+        // COMMENT: for the moment, they're just points
+        TEvePointSet *this_found_v0 = new TEvePointSet();
+        // this_found_v0->SetNextPoint(0, 0, 0);  // PENDING!!
+        this_found_v0->SetNextPoint(these_v0s.X[evt_v0], these_v0s.Y[evt_v0], these_v0s.Z[evt_v0]);
+        this_found_v0->SetMarkerSize(2.);
+        this_found_v0->SetMarkerColor(kSpring);
+        this_found_v0->SetMainColor(kSpring);
+        this_found_v0->SetName(Form("found_V0_%i", evt_v0));
+
+        parent->AddElement(this_found_v0);
+
+        aux_v0_vertex[0] = these_v0s.X[evt_v0];
+        aux_v0_vertex[1] = these_v0s.Y[evt_v0];
+        aux_v0_vertex[2] = these_v0s.Z[evt_v0];
+
+        /* Negative Daughter */
+
+        // (debug)
+        LOG_DEBUG("EventDisplay :: Found V0s :: Negative Daughter :: idx_neg = %i\n", these_v0s.Idx_Neg[evt_v0]);
+
+        TEveLine *this_neg_dau = new TEveLine();
+
+        // get helix params, from the reconstructed track rather than from the V0, so that they're independent of the V0 vertex
+        GetTrackHelixParams(this_event, these_tracks, these_v0s.Idx_Neg[evt_v0], aux_neg_helix_params);
+        LOG_DEBUG("EventDisplay :: Found V0s :: Negative Daughter :: Params = {%.3f, %.3f, %.3f, %.3f, %.3f, %.3f}\n",  //
+               aux_neg_helix_params[0], aux_neg_helix_params[1],                                                     //
+               aux_neg_helix_params[2], aux_neg_helix_params[3],                                                     //
+               aux_neg_helix_params[4], aux_neg_helix_params[5]);
+        LOG_DEBUG("EventDisplay :: Found V0s :: Negative Daughter :: AliExternParams = {%.3f, %.3f, %.3f, %.3f, %.3f, %.3f}\n",
+               these_tracks.HelixParam0[these_v0s.Idx_Neg[evt_v0]],
+               these_tracks.HelixParam1[these_v0s.Idx_Neg[evt_v0]],  //
+               these_tracks.HelixParam2[these_v0s.Idx_Neg[evt_v0]],
+               these_tracks.HelixParam3[these_v0s.Idx_Neg[evt_v0]],  //
+               these_tracks.HelixParam4[these_v0s.Idx_Neg[evt_v0]],
+               these_tracks.HelixParam5[these_v0s.Idx_Neg[evt_v0]]);
+
+        // (1) search for min. track path, i.e. the point of the helix closest to the V0
+        aux_min_dist_to_v0 = GetDCAHelixToPoint(aux_neg_helix_params, aux_v0_vertex, aux_min_track_path);
+
+        // (debug)
+        LOG_DEBUG("EventDisplay :: Found V0s :: Negative Daughter :: min_dist_to_v0 = %f\n", aux_min_dist_to_v0);
+        LOG_DEBUG("EventDisplay :: Found V0s :: Negative Daughter :: min_track_path = %f\n", aux_min_track_path);
+
+        // (2) draw track, from there on
+        {
+            ScopedTimer timer("Helix sampling");
+            SampleHelix(this_neg_dau, aux_neg_helix_params, aux_min_track_path, 750.);
+        }
+
+        this_neg_dau->SetLineStyle(1);
+        this_neg_dau->SetLineWidth(LINE_WIDTH);
+        this_neg_dau->SetName(Form("found_V0_%i_neg", evt_v0));
+        this_neg_dau->SetMainColor(kMagenta);
+
+        parent->AddElement(this_neg_dau);
+
+        /* Positive Daughter */
+
+        // (debug)
+        LOG_DEBUG("EventDisplay :: Found V0s :: Positive Daughter :: idx_pos = %i\n", these_v0s.Idx_Pos[evt_v0]);
+
+        TEveLine *this_pos_dau = new TEveLine();
+
+        // get helix params, from the reconstructed track rather than from the V0, so that they're independent of the V0 vertex
+        GetTrackHelixParams(this_event, these_tracks, these_v0s.Idx_Pos[evt_v0], aux_pos_helix_params);
+        LOG_DEBUG("EventDisplay :: Found V0s :: Positive Daughter :: Params = {%.3f, %.3f, %.3f, %.3f, %.3f, %.3f}\n",  //
+               aux_pos_helix_params[0], aux_pos_helix_params[1],                                                     //
+               aux_pos_helix_params[2], aux_pos_helix_params[3],                                                     //
+               aux_pos_helix_params[4], aux_pos_helix_params[5]);
+        LOG_DEBUG("EventDisplay :: Found V0s :: Positive Daughter :: AliExternParams = {%.3f, %.3f, %.3f, %.3f, %.3f, %.3f}\n",
+               these_tracks.HelixParam0[these_v0s.Idx_Pos[evt_v0]],
+               these_tracks.HelixParam1[these_v0s.Idx_Pos[evt_v0]],  //
+               these_tracks.HelixParam2[these_v0s.Idx_Pos[evt_v0]],
+               these_tracks.HelixParam3[these_v0s.Idx_Pos[evt_v0]],  //
+               these_tracks.HelixParam4[these_v0s.Idx_Pos[evt_v0]],
+               these_tracks.HelixParam5[these_v0s.Idx_Pos[evt_v0]]);
+
+        // (1) search for min. track path, i.e. the point of the helix closest to the V0
+        aux_min_dist_to_v0 = GetDCAHelixToPoint(aux_pos_helix_params, aux_v0_vertex, aux_min_track_path);
+
+        // (debug)
+        LOG_DEBUG("EventDisplay :: Found V0s :: Positive Daughter :: min_dist_to_v0 = %f\n", aux_min_dist_to_v0);
+        LOG_DEBUG("EventDisplay :: Found V0s :: Positive Daughter :: min_track_path = %f\n", aux_min_track_path);
+
+        // (2) draw track, from there on
+        {
+            ScopedTimer timer("Helix sampling");
+            SampleHelix(this_pos_dau, aux_pos_helix_params, aux_min_track_path, 750.);
+        }
+
+        this_pos_dau->SetLineStyle(1);
+        this_pos_dau->SetLineWidth(LINE_WIDTH);
+        this_pos_dau->SetName(Form("found_V0_%i_pos", evt_v0));
+        this_pos_dau->SetMainColor(kCyan);
+
+        parent->AddElement(this_pos_dau);
+
+        /* V0 Vertex */
+
+        // (debug) both daughters should meet at the V0
+        LOG_DEBUG("EventDisplay :: Found V0s :: DCA between daughters = %.3f (stored: %.3f)\n",
+               GetDCAHelixToHelix(aux_neg_helix_params, aux_pos_helix_params, aux_neg_dca_path, aux_pos_dca_path),
+               these_v0s.DCA_Daughters[evt_v0]);
+        LOG_DEBUG("EventDisplay :: Found V0s :: DCA paths = (%.3f, %.3f)\n", aux_neg_dca_path, aux_pos_dca_path);
+
+    }  // end of loop over found V0s
+}
+
+// level of detail of the full event: tracks far from the camera cover fewer pixels, so they're sampled with a coarser tolerance
+// - level 0, the full HELIX_TOLERANCE, up to LOD_DISTANCE from the camera
+// - every next level spans LOD_FACTOR times farther, and multiplies the tolerance by LOD_FACTOR,
+//   which keeps the error on screen about the same
+#define LOD_LEVELS 3
+#define LOD_DISTANCE 250.        // [cm]
+#define LOD_FACTOR 4.            // x4 tolerance = x2 larger steps
+#define LOD_UPDATE_INTERVAL 250  // [ms] how often the camera is checked for changes
+#define LINE_SET_CHUNK_SIZE 4096
+
+//_____________________________________________________________________________
+struct EventPool_tt {
+    //
+    // Elements of the full event, created once and refilled for every event
+    //
+    TEveStraightLineSet *Signal_Tracks = nullptr;             // tracks that belong to the anti-sexaquark signal
+    TEveStraightLineSet *Pos_Tracks = nullptr;                // positive background tracks
+    TEveStraightLineSet *Neg_Tracks = nullptr;                // negative background tracks
+    TEvePointSet *Signal_V0s = nullptr;                       // vertices of signal V0s
+    TEvePointSet *Background_V0s = nullptr;                   // vertices of background V0s
+    std::vector<std::array<Double_t, 8>> Helix_Params;        // helix of each track of the event
+    std::vector<Double_t> Path_End;                           // path where each track leaves the TPC
+    std::vector<TEveStraightLineSet *> Track_Set;             // where each track is drawn
+    std::vector<Int_t> Level;                                 // current level of detail of each track
+    Double_t Eye[3] = {0., 0., 0.};                           // camera position of the current levels
+    HelixBatch_tt Batch[LOD_LEVELS];                          // helices of each level of detail
+    std::vector<TEveStraightLineSet *> Line_Set[LOD_LEVELS];  // where each helix of the batches is drawn
+};
+
+//_____________________________________________________________________________
+void InitEventPool(EventPool_tt &pool, TEveElement *parent) {
+    //
+    // Create the pooled elements and add them to parent, once per session
+    //
+    pool.Signal_Tracks = new TEveStraightLineSet("Signal Tracks");
+    pool.Signal_Tracks->SetLineColor(kGreen);
+
+    pool.Pos_Tracks = new TEveStraightLineSet("Positive Tracks");
+    pool.Pos_Tracks->SetLineColor(kCyan);
+
+    pool.Neg_Tracks = new TEveStraightLineSet("Negative Tracks");
+    pool.Neg_Tracks->SetLineColor(kMagenta);
+
+    for (TEveStraightLineSet *line_set : {pool.Signal_Tracks, pool.Pos_Tracks, pool.Neg_Tracks}) {
+        line_set->SetLineWidth(LINE_WIDTH);
+        parent->AddElement(line_set);
+    }
+    pool.Pos_Tracks->SetMainTransparency(50);
+    pool.Neg_Tracks->SetMainTransparency(50);
+
+    pool.Signal_V0s = new TEvePointSet("Signal V0s");
+    pool.Signal_V0s->SetMarkerColor(kSpring);
+    pool.Signal_V0s->SetMarkerSize(2.);
+
+    pool.Background_V0s = new TEvePointSet("Background V0s");
+    pool.Background_V0s->SetMarkerColor(kGray);
+    pool.Background_V0s->SetMarkerSize(1.);
+
+    for (TEvePointSet *point_set : {pool.Signal_V0s, pool.Background_V0s}) {
+        point_set->SetMarkerStyle(20);
+        parent->AddElement(point_set);
+    }
+}
+
+//_____________________________________________________________________________
+void GetCameraPosition(Double_t eye[3]) {
+    TGLVertex3 eye_point = gEve->GetDefaultGLViewer()->CurrentCamera().EyePoint();
+    eye[0] = eye_point.X();
+    eye[1] = eye_point.Y();
+    eye[2] = eye_point.Z();
+}
+
+//_____________________________________________________________________________
+Int_t GetLevelOfDetail(Double_t distance) {
+    Int_t level = 0;
+    Double_t level_distance = LOD_DISTANCE;
+    while (level < LOD_LEVELS - 1 && distance > level_distance) {
+        level++;
+        level_distance *= LOD_FACTOR;
+    }
+    return level;
+}
+
+//_____________________________________________________________________________
+Bool_t UpdateLevelOfDetail(EventPool_tt &pool, Double_t eye[3], Bool_t force = kFALSE) {
+    //
+    // Assign each track of the pool a level of detail from its distance to the camera at eye,
+    // and sample the tracks again only if the camera moved and some track changed level, or if force is set
+    // Return whether the line sets were refilled
+    //
+    if (!force && eye[0] == pool.Eye[0] && eye[1] == pool.Eye[1] && eye[2] == pool.Eye[2]) return kFALSE;
+    std::copy(eye, eye + 3, pool.Eye);
+
+    Int_t n_tracks = (Int_t)pool.Helix_Params.size();
+    Bool_t level_changed = force;
+    Double_t aux_path;
+    Double_t aux_r[3];
+
+    // distance from the camera to the drawn part of each track, i.e. its closest point clamped to [0, Path_End]
+    for (Int_t trk = 0; trk < n_tracks; trk++) {
+        Double_t *params = pool.Helix_Params[trk].data();
+        GetDCAHelixToPoint(params, eye, aux_path);
+        EvaluateHelix(params, TMath::Min(TMath::Max(aux_path, 0.), pool.Path_End[trk]), aux_r);
+        Int_t this_level = GetLevelOfDetail(TMath::Sqrt((aux_r[0] - eye[0]) * (aux_r[0] - eye[0]) +  //
+                                                        (aux_r[1] - eye[1]) * (aux_r[1] - eye[1]) +  //
+                                                        (aux_r[2] - eye[2]) * (aux_r[2] - eye[2])));
+        if (this_level != pool.Level[trk]) level_changed = kTRUE;
+        pool.Level[trk] = this_level;
+    }
+
+    if (!level_changed) return kFALSE;
+
+    {
+        ScopedTimer timer("Helix sampling");
+
+        for (Int_t level = 0; level < LOD_LEVELS; level++) {
+            ClearHelixBatch(pool.Batch[level]);
+            pool.Line_Set[level].clear();
+        }
+
+        for (Int_t trk = 0; trk < n_tracks; trk++) {
+            AddHelixToBatch(pool.Batch[pool.Level[trk]], pool.Helix_Params[trk].data(), 0., 750.);
+            pool.Line_Set[pool.Level[trk]].push_back(pool.Track_Set[trk]);
+        }
+
+        Double_t tolerance = HELIX_TOLERANCE;
+        for (Int_t level = 0; level < LOD_LEVELS; level++) {
+            SampleHelixBatch(pool.Batch[level], tolerance);
+            tolerance *= LOD_FACTOR;
+        }
+    }
+
+    ScopedTimer timer("Element creation");
+
+    for (TEveStraightLineSet *line_set : {pool.Signal_Tracks, pool.Pos_Tracks, pool.Neg_Tracks}) {
+        line_set->GetLinePlex().Reset(sizeof(TEveStraightLineSet::Line_t), LINE_SET_CHUNK_SIZE);
+        line_set->GetMarkerPlex().Reset(sizeof(TEveStraightLineSet::Marker_t), LINE_SET_CHUNK_SIZE);
+    }
+
+    for (Int_t level = 0; level < LOD_LEVELS; level++) {
+        HelixBatch_tt &batch = pool.Batch[level];
+        for (Int_t i = 0; i < batch.N; i++) {
+            TEveStraightLineSet *line_set = pool.Line_Set[level][i];
+            Int_t first = batch.First_Point[i];
+            Int_t last = first + batch.N_Points[i] - 1;
+            for (Int_t k = first; k < last; k++) {
+                line_set->AddLine(batch.X[k], batch.Y[k], batch.Z[k], batch.X[k + 1], batch.Y[k + 1], batch.Z[k + 1]);
+            }
+        }
+        // (debug) runs on every camera change
+        LOG_DEBUG("EventDisplay :: Full Event :: Level %i :: %i tracks, %zu points\n", level, batch.N, batch.X.size());
+    }
+
+    for (TEveStraightLineSet *line_set : {pool.Signal_Tracks, pool.Pos_Tracks, pool.Neg_Tracks}) {
+        line_set->ResetBBox();
+        line_set->ElementChanged();
+    }
+
+    return kTRUE;
+}
+
+//_____________________________________________________________________________
+void DrawFullEvent(Event_tt &this_event, Tracks_tt &these_tracks, V0s_tt &these_v0s, EventPool_tt &pool, Double_t eye[3]) {
+    //
+    // Refill the pooled elements with all the reconstructed tracks and V0s of this event
+    // - eye: camera position, see UpdateLevelOfDetail()
+    // - tracks start at the generation vertex of their true MC particle, see GetTrackHelixParams()
+    //
+
+    LOG_INFO("EventDisplay :: Full Event :: %i tracks, %i V0s\n", these_tracks.N, these_v0s.N);
+
+    /* Tracks */
+
+    pool.Helix_Params.resize(these_tracks.N);
+    pool.Path_End.resize(these_tracks.N);
+    pool.Track_Set.resize(these_tracks.N);
+    pool.Level.assign(these_tracks.N, -1);
+
+    for (Int_t trk = 0; trk < these_tracks.N; trk++) {
+
+        GetTrackHelixParams(this_event, these_tracks, trk, pool.Helix_Params[trk].data());
+        pool.Path_End[trk] = GetTPCExitPath(pool.Helix_Params[trk].data(), 0., 750.);
+
+        if (these_tracks.isSignal[trk]) {
+            pool.Track_Set[trk] = pool.Signal_Tracks;
+        } else {
+            pool.Track_Set[trk] = these_tracks.Charge[trk] > 0 ? pool.Pos_Tracks : pool.Neg_Tracks;
+        }
+    }
+
+    UpdateLevelOfDetail(pool, eye, kTRUE);
+
+    // (debug) the reduction of points with respect to sampling everything at level 0
+    for (Int_t level = 0; level < LOD_LEVELS; level++) {
+        LOG_INFO("EventDisplay :: Full Event :: Level %i :: %i tracks, %zu points\n", level, pool.Batch[level].N,  //
+                 pool.Batch[level].X.size());
+    }
+
+    /* V0s */
+
+    pool.Signal_V0s->Reset();
+    pool.Background_V0s->Reset();
+
+    for (Int_t v0 = 0; v0 < these_v0s.N; v0++) {
+        TEvePointSet *point_set = these_v0s.isSignal[v0] ? pool.Signal_V0s : pool.Background_V0s;
+        point_set->SetNextPoint(these_v0s.X[v0], these_v0s.Y[v0], these_v0s.Z[v0]);
+    }
+
+    for (TEvePointSet *point_set : {pool.Signal_V0s, pool.Background_V0s}) {
+        point_set->ResetBBox();
+        point_set->ElementChanged();
+    }
+}
+
+//_____________________________________________________________________________
+void SaveViewAsPicture(TString output_filename, Int_t width = 1200, Int_t height = 900) {
+    //
+    // Render the default viewer off-screen and save it as an image, the format is given by the extension
+    //
+    gEve->FullRedraw3D(kFALSE);
+    gSystem->ProcessEvents();
+    gEve->GetDefaultGLViewer()->SavePictureUsingFBO(output_filename, width, height);
+}
+
+//_____________________________________________________________________________
+void AddElementsToArray(TEveElement *parent, TObjArray *array) {
+    //
+    // Convert the lines and points under parent into plain 3D primitives, which can be read by the JSROOT web viewer
+    //
+    for (TEveElement::List_i it = parent->BeginChildren(); it != parent->EndChildren(); ++it) {
+        if (TEveLine *this_line = dynamic_cast<TEveLine *>(*it)) {
+            TPolyLine3D *this_polyline = new TPolyLine3D(this_line->Size(), this_line->GetP());
+            this_polyline->SetLineColor(this_line->GetMainColor());
+            this_polyline->SetLineStyle(this_line->GetLineStyle());
+            this_polyline->SetLineWidth(this_line->GetLineWidth());
+            array->Add(this_polyline);
+        } else if (TEvePointSet *this_points = dynamic_cast<TEvePointSet *>(*it)) {
+            TPolyMarker3D *this_polymarker = new TPolyMarker3D(this_points->Size(), this_points->GetP());
+            this_polymarker->SetMarkerColor(this_points->GetMarkerColor());
+            this_polymarker->SetMarkerSize(this_points->GetMarkerSize());
+            this_polymarker->SetMarkerStyle(this_points->GetMarkerStyle());
+            array->Add(this_polymarker);
+        }
+        AddElementsToArray(*it, array);
+    }
+}
+
+//_____________________________________________________________________________
+void SaveViewAsJSON(TEveElement *parent, TString output_filename) {
+    //
+    // Save the elements under parent as JSON, to be shown in the JSROOT web viewer
+    //
+    TObjArray array;
+    array.SetOwner(kTRUE);
+    AddElementsToArray(parent, &array);
+    TBufferJSON::ExportToFile(output_filename, &array);
+}
+
+//_____________________________________________________________________________
+void SaveGeometryAsJSON(TString output_filename) {
+    //
+    // Save the displayed geometry as JSON, to be overlaid on the candidates in the JSROOT web viewer
+    //
+    TEveGeoShapeExtract *geometry_extract = LoadGeometryCache();
+    if (geometry_extract) TBufferJSON::ExportToFile(output_filename, geometry_extract);
+}
+
+#endif